@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/atomic>
+
+// Lock-free 16-byte atomics on hosts with a double-width compare-and-swap.
+
+// Every x86-64 machine the tests run on has cmpxchg16b, whether or not the
+// compiler targets it.
+#define _LIBCUDACXX_HOST_HAS_CMPXCHG16B
+
+#include <cuda/atomic>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+#ifndef _LIBCUDACXX_HAS_NO_HOST_ATOMIC_16
+
+struct tagged_ptr {
+  int* ptr;
+  unsigned long long tag;
+};
+
+template <cuda::thread_scope Sco>
+void test()
+{
+  typedef cuda::atomic<tagged_ptr, Sco> A;
+  static_assert(A::is_always_lock_free, "");
+  static_assert(cuda::atomic_ref<tagged_ptr, Sco>::is_always_lock_free, "");
+
+  int values[2] = {0, 1};
+  {
+    local_memory_selector<A, constructor_initializer> sel;
+    A * a = sel.construct(tagged_ptr{values, 0});
+    assert(a->is_lock_free());
+
+    // Each successful swap bumps the tag, so an ABA on the pointer half
+    // still fails the comparison.
+    auto worker = [a, &values](){
+      for (int i = 0; i < 10000; ++i) {
+        tagged_ptr expected = a->load(cuda::std::memory_order_relaxed);
+        tagged_ptr desired;
+        do {
+          desired.ptr = values + (expected.ptr == values ? 1 : 0);
+          desired.tag = expected.tag + 1;
+        } while (!a->compare_exchange_weak(expected, desired));
+      }
+    };
+
+    concurrent_agents_launch(worker, worker);
+
+    tagged_ptr result = a->load();
+    assert(result.tag == 20000);
+    assert(result.ptr == values);
+
+    result = a->exchange(tagged_ptr{values + 1, 7});
+    assert(result.tag == 20000);
+    a->store(tagged_ptr{values, 8});
+    assert(a->load().tag == 8);
+  }
+  {
+    // atomic_ref requires the object to be aligned to its size.
+    alignas(16) tagged_ptr storage{values, 0};
+    cuda::atomic_ref<tagged_ptr, Sco> ref(storage);
+    assert(ref.is_lock_free());
+
+    tagged_ptr expected{values + 1, 0};
+    assert(!ref.compare_exchange_strong(expected, tagged_ptr{values, 1}));
+    assert(expected.ptr == values && expected.tag == 0);
+    assert(ref.compare_exchange_strong(expected, tagged_ptr{values + 1, 1}));
+    assert(storage.ptr == values + 1 && storage.tag == 1);
+  }
+  {
+    typedef cuda::atomic<__int128, Sco> I;
+    static_assert(I::is_always_lock_free, "");
+
+    local_memory_selector<I, constructor_initializer> sel;
+    I * i = sel.construct(0);
+    __int128 const one = (__int128(1) << 64) | 1;
+
+    auto worker = [i, one](){
+      for (int n = 0; n < 10000; ++n) {
+        i->fetch_add(one);
+      }
+    };
+
+    concurrent_agents_launch(worker, worker);
+
+    assert(i->load() == one * 20000);
+    assert(i->fetch_sub(one) == one * 20000);
+    assert(i->fetch_xor(one) == one * 19999);
+  }
+}
+
+#endif // _LIBCUDACXX_HAS_NO_HOST_ATOMIC_16
+
+int main(int, char**)
+{
+#ifndef _LIBCUDACXX_HAS_NO_HOST_ATOMIC_16
+    NV_IF_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 2;
+
+      test<cuda::thread_scope_system>();
+      test<cuda::thread_scope_device>();
+      test<cuda::thread_scope_block>();
+    ))
+#endif // _LIBCUDACXX_HAS_NO_HOST_ATOMIC_16
+
+    return 0;
+}
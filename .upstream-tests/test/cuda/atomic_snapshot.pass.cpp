@@ -0,0 +1,125 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/atomic>
+
+// cuda::atomic_snapshot<T>
+
+#include <cuda/atomic>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template <int N>
+struct config {
+  int values[N];
+};
+
+template <int N>
+__host__ __device__
+bool consistent(config<N> const& c)
+{
+  for (int i = 1; i < N; ++i) {
+    if (c.values[i] != c.values[0]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <int N>
+__host__ __device__
+config<N> make_config(int v)
+{
+  config<N> c;
+  for (int i = 0; i < N; ++i) {
+    c.values[i] = v;
+  }
+  return c;
+}
+
+template <int N, cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test()
+{
+  typedef cuda::atomic_snapshot<config<N>, Sco> S;
+
+  Selector<S, constructor_initializer> sel;
+  SHARED S * s;
+  s = sel.construct(make_config<N>(0));
+
+  assert(s->load().values[0] == 0);
+
+  auto writer = LAMBDA (){
+    for (int i = 1; i <= 1000; ++i) {
+      if (i % 2) {
+        s->store(make_config<N>(i));
+      }
+      else {
+        config<N> old = s->exchange(make_config<N>(i));
+        assert(consistent(old) && old.values[0] == i - 1);
+      }
+    }
+  };
+  auto reader = LAMBDA (){
+    int last = 0;
+    while (last != 1000) {
+      config<N> c = s->load();
+      assert(consistent(c));
+      assert(c.values[0] >= last);
+      last = c.values[0];
+    }
+  };
+
+  concurrent_agents_launch(writer, reader);
+
+  s->update([](config<N>& c){ c.values[N - 1] += 1; });
+  config<N> c = *s;
+  assert(c.values[0] == (N == 1 ? 1001 : 1000) && c.values[N - 1] == 1001);
+}
+
+template <cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test_sizes()
+{
+  test<1, Sco, Selector>();
+  test<3, Sco, Selector>();
+  test<16, Sco, Selector>();
+  test<64, Sco, Selector>();
+}
+
+template <template<typename, typename> typename Selector>
+__host__ __device__
+void test_scopes()
+{
+  test_sizes<cuda::thread_scope_system, Selector>();
+  test_sizes<cuda::thread_scope_device, Selector>();
+  test_sizes<cuda::thread_scope_block, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 2;
+
+      test_scopes<local_memory_selector>();
+    ),(
+      test_scopes<shared_memory_selector>();
+      test_scopes<global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+// UNSUPPORTED: c++98, c++03, c++11
+
+// <cuda/std/atomic>
+
+// size_t atomic_wait_any(span<A* const> objects, span<T> old, memory_order m = memory_order_seq_cst);
+// size_t atomic_wait_any(span<A*> objects, span<T> old, memory_order m = memory_order_seq_cst);
+// void atomic_wait_all(span<A* const> objects, span<T> old, memory_order m = memory_order_seq_cst);
+// void atomic_wait_all(span<A*> objects, span<T> old, memory_order m = memory_order_seq_cst);
+
+#include <cuda/atomic>
+#include <cuda/std/span>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template <class T, cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test()
+{
+  typedef cuda::atomic<T, Sco> A;
+
+  Selector<A, constructor_initializer> sel0;
+  Selector<A, constructor_initializer> sel1;
+  Selector<A, constructor_initializer> sel2;
+  SHARED A * a[3];
+  a[0] = sel0.construct(T(0));
+  a[1] = sel1.construct(T(0));
+  a[2] = sel2.construct(T(0));
+
+  {
+    A * const objs[3] = {a[0], a[1], a[2]};
+    T const old[3] = {T(0), T(0), T(0)};
+    a[2]->store(T(1));
+    assert(cuda::std::atomic_wait_any(cuda::std::span<A * const, 3>(objs), cuda::std::span<T const, 3>(old)) == 2);
+    a[2]->store(T(0));
+  }
+  {
+    T old[3] = {T(0), T(0), T(0)};
+    a[1]->store(T(1));
+    assert(cuda::std::atomic_wait_any(cuda::std::span<A *, 3>(a), cuda::std::span<T, 3>(old)) == 1);
+    a[0]->store(T(1));
+    a[2]->store(T(1));
+    cuda::std::atomic_wait_all(cuda::std::span<A *>(a, 3), cuda::std::span<T>(old, 3));
+    for (int i = 0; i < 3; ++i)
+      a[i]->store(T(0));
+  }
+
+  auto waiter = LAMBDA (){
+    A * const objs[3] = {a[0], a[1], a[2]};
+    T const old[3] = {T(0), T(0), T(0)};
+    size_t const i = cuda::std::atomic_wait_any(cuda::std::span<A * const>(objs, 3), cuda::std::span<T const>(old, 3));
+    assert(i < 3);
+    assert(a[i]->load() != T(0));
+
+    // The last store the notifier makes is to a[2], so once every object
+    // has changed they all hold their final value.
+    cuda::std::atomic_wait_all(cuda::std::span<A * const>(objs, 3), cuda::std::span<T const>(old, 3),
+                               cuda::std::memory_order_acquire);
+    assert(a[0]->load() == T(2) && a[1]->load() == T(2) && a[2]->load() == T(2));
+  };
+  auto notifier = LAMBDA (){
+    a[1]->store(T(1));
+    a[1]->notify_all();
+    for (int i = 0; i < 3; ++i) {
+      a[i]->store(T(2));
+      a[i]->notify_one();
+    }
+  };
+
+  concurrent_agents_launch(waiter, notifier);
+}
+
+template <cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test_types()
+{
+  test<int, Sco, Selector>();
+  test<unsigned long long, Sco, Selector>();
+  test<signed char, Sco, Selector>();
+}
+
+template <template<typename, typename> typename Selector>
+__host__ __device__
+void test_scopes()
+{
+  test_types<cuda::thread_scope_system, Selector>();
+  test_types<cuda::thread_scope_device, Selector>();
+  test_types<cuda::thread_scope_block, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 2;
+
+      test_scopes<local_memory_selector>();
+    ),(
+      test_scopes<shared_memory_selector>();
+      test_scopes<global_memory_selector>();
+    ))
+
+    return 0;
+}
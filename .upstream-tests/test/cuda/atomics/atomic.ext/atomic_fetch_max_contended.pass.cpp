@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/atomic>
+
+// Concurrent fetch_max, fetch_min and floating-point fetch_add.
+
+#include <cuda/atomic>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template <class T, cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test()
+{
+  typedef cuda::atomic<T, Sco> A;
+
+  Selector<A, constructor_initializer> sel_max;
+  Selector<A, constructor_initializer> sel_min;
+  SHARED A * max;
+  SHARED A * min;
+  max = sel_max.construct(T(0));
+  min = sel_min.construct(T(100));
+
+  // Whatever the interleaving, the objects end at the extremes of both sequences.
+  auto up = LAMBDA (){
+    for (int i = 0; i < 100; ++i) {
+      T const old = max->fetch_max(T(i), cuda::std::memory_order_acq_rel);
+      assert(old <= T(99));
+      min->fetch_min(T(99 - i), cuda::std::memory_order_release);
+    }
+  };
+  auto down = LAMBDA (){
+    for (int i = 99; i >= 0; --i) {
+      max->fetch_max(T(i), cuda::std::memory_order_relaxed);
+      T const old = min->fetch_min(T(i), cuda::std::memory_order_acquire);
+      assert(old >= T(0));
+    }
+  };
+
+  concurrent_agents_launch(up, down);
+
+  assert(max->load() == T(99));
+  assert(min->load() == T(0));
+  assert(max->fetch_max(T(5), cuda::std::memory_order_seq_cst) == T(99));
+  assert(min->fetch_min(T(5), cuda::std::memory_order_seq_cst) == T(0));
+}
+
+template <class T, cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test_float_add()
+{
+  typedef cuda::atomic<T, Sco> A;
+
+  Selector<A, constructor_initializer> sel;
+  SHARED A * a;
+  a = sel.construct(T(0));
+
+  // Sums of small integers are exact, whatever order the adds land in.
+  auto adder = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      a->fetch_add(T(1), cuda::std::memory_order_relaxed);
+    }
+  };
+  auto subber = LAMBDA (){
+    for (int i = 0; i < 500; ++i) {
+      a->fetch_sub(T(1), cuda::std::memory_order_acq_rel);
+    }
+  };
+
+  concurrent_agents_launch(adder, subber);
+
+  assert(a->load() == T(500));
+}
+
+template <cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test_types()
+{
+  test<signed char, Sco, Selector>();
+  test<unsigned short, Sco, Selector>();
+  test<int, Sco, Selector>();
+  test<unsigned, Sco, Selector>();
+  test<long long, Sco, Selector>();
+  test<unsigned long long, Sco, Selector>();
+  test<float, Sco, Selector>();
+  test<double, Sco, Selector>();
+  test_float_add<float, Sco, Selector>();
+  test_float_add<double, Sco, Selector>();
+}
+
+template <template<typename, typename> typename Selector>
+__host__ __device__
+void test_scopes()
+{
+  test_types<cuda::thread_scope_system, Selector>();
+  test_types<cuda::thread_scope_device, Selector>();
+  test_types<cuda::thread_scope_block, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 2;
+
+      test_scopes<local_memory_selector>();
+    ),(
+      test_scopes<shared_memory_selector>();
+      test_scopes<global_memory_selector>();
+    ))
+
+    return 0;
+}
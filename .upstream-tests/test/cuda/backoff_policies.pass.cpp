@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+#include <cuda/atomic>
+#include <cuda/barrier>
+#include <cuda/latch>
+#include <cuda/semaphore>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Backoff, cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test()
+{
+  {
+    Selector<cuda::atomic<int, Sco>, constructor_initializer> sel;
+    SHARED cuda::atomic<int, Sco> * a;
+    a = sel.construct(0);
+
+    auto notifier = LAMBDA (){
+      a->store(1);
+      a->notify_all();
+    };
+    auto waiter = LAMBDA (){
+      a->wait(0, cuda::memory_order_acquire, Backoff());
+      assert(a->load() == 1);
+    };
+
+    concurrent_agents_launch(notifier, waiter);
+  }
+  {
+    Selector<cuda::latch<Sco>, constructor_initializer> sel;
+    SHARED cuda::latch<Sco> * l;
+    l = sel.construct(2);
+
+    auto worker = LAMBDA (){
+      l->arrive_and_wait(1, Backoff());
+    };
+
+    concurrent_agents_launch(worker, worker);
+  }
+  {
+    Selector<cuda::barrier<Sco>, constructor_initializer> sel;
+    SHARED cuda::barrier<Sco> * b;
+    b = sel.construct(2);
+
+    auto worker = LAMBDA (){
+      b->arrive_and_wait(Backoff());
+      b->wait(b->arrive(), Backoff());
+    };
+
+    concurrent_agents_launch(worker, worker);
+  }
+  {
+    Selector<cuda::counting_semaphore<Sco>, constructor_initializer> sel;
+    SHARED cuda::counting_semaphore<Sco> * s;
+    s = sel.construct(0);
+
+    auto releaser = LAMBDA (){
+      s->release(2);
+    };
+    auto acquirer = LAMBDA (){
+      s->acquire(Backoff());
+      s->acquire(Backoff());
+    };
+
+    concurrent_agents_launch(acquirer, releaser);
+  }
+  {
+    Selector<cuda::binary_semaphore<Sco>, constructor_initializer> sel;
+    SHARED cuda::binary_semaphore<Sco> * s;
+    s = sel.construct(0);
+
+    auto releaser = LAMBDA (){
+      s->release();
+    };
+    auto acquirer = LAMBDA (){
+      s->acquire(Backoff());
+    };
+
+    concurrent_agents_launch(acquirer, releaser);
+  }
+}
+
+template<typename Backoff,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test_scopes()
+{
+  test<Backoff, cuda::thread_scope_system, Selector>();
+  test<Backoff, cuda::thread_scope_device, Selector>();
+  test<Backoff, cuda::thread_scope_block, Selector>();
+}
+
+template<template<typename, typename> typename Selector>
+__host__ __device__
+void test_policies()
+{
+  test_scopes<cuda::default_backoff, Selector>();
+  test_scopes<cuda::yield_backoff, Selector>();
+  test_scopes<cuda::exponential_backoff<>, Selector>();
+  test_scopes<cuda::exponential_backoff<4>, Selector>();
+  test_scopes<cuda::calibrated_backoff<2000>, Selector>();
+  test_scopes<cuda::sleep_capped_backoff<50000>, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 2;
+
+      test_policies<local_memory_selector>();
+    ),(
+      test_policies<shared_memory_selector>();
+      test_policies<global_memory_selector>();
+    ))
+
+    return 0;
+}
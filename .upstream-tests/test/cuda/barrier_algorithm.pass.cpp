@@ -0,0 +1,171 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/barrier>
+
+// cuda::barrier<Sco, F, cuda::barrier_tree<Storage>>
+// cuda::barrier<Sco, F, cuda::barrier_dissemination<Storage>>
+// cuda::barrier<Sco, F, cuda::barrier_tournament<Storage>>
+// cuda::barrier<Sco, F, cuda::barrier_hierarchical<Storage>>
+
+#include <cuda/barrier>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+struct arena_resource {
+  unsigned char * base;
+  cuda::std::size_t size;
+  int * live;
+
+  void * allocate(cuda::std::size_t bytes, cuda::std::size_t alignment) {
+    assert(bytes <= size);
+    assert(reinterpret_cast<cuda::std::uintptr_t>(base) % alignment == 0);
+    ++*live;
+    return base;
+  }
+  void deallocate(void * p, cuda::std::size_t, cuda::std::size_t) {
+    assert(p == base);
+    --*live;
+  }
+};
+
+template<cuda::thread_scope Sco,
+    template<typename> class Algorithm, class Storage,
+    template<typename, typename> class Selector,
+    class... StorageArgs>
+__host__ __device__
+void test(StorageArgs... args)
+{
+  global_memory_selector<int> int_sel;
+  SHARED int * x;
+  x = int_sel.construct(0);
+
+  auto comp = LAMBDA () { *x += 1; };
+
+  typedef cuda::barrier<Sco, decltype(comp), Algorithm<Storage>> B;
+  Selector<B, constructor_initializer> sel;
+  SHARED B * b;
+  b = sel.construct(9, comp, args...);
+
+  // Nine participants need more than one level of every algorithm. One
+  // drops out after an odd phase and one after an even phase, so the tree
+  // sees a change in the expected count in both counting directions.
+  auto worker = LAMBDA () {
+    for (int i = 0; i < 10; ++i) {
+      b->arrive_and_wait();
+      assert(*x == i + 1);
+    }
+  };
+  auto dropper5 = LAMBDA () {
+    for (int i = 0; i < 5; ++i) {
+      b->arrive_and_wait();
+    }
+    b->arrive_and_drop();
+  };
+  auto dropper6 = LAMBDA () {
+    for (int i = 0; i < 6; ++i) {
+      b->arrive_and_wait();
+    }
+    b->arrive_and_drop();
+  };
+
+  concurrent_agents_launch(worker, worker, worker, worker, worker, worker, worker, dropper5, dropper6);
+
+  assert(*x == 10);
+}
+
+template<cuda::thread_scope Sco, template<typename> class Algorithm>
+void test_host()
+{
+  typedef cuda::barrier<Sco, cuda::std::__empty_completion, Algorithm<cuda::barrier_inline_storage<32>>> B;
+  static_assert(B::max() == 32, "");
+
+  {
+    B b(6);
+    // A single thread may arrive for any number of participants at once.
+    auto token = b.arrive(6);
+    b.wait(cuda::std::move(token));
+    token = b.arrive(2);
+    (void)b.arrive(3);
+    token = b.arrive(1);
+    b.wait(cuda::std::move(token));
+  }
+  {
+    B b(0);
+  }
+
+  alignas(64) unsigned char arena[64 * 64];
+  int live = 0;
+  {
+    typedef cuda::barrier<Sco, cuda::std::__empty_completion,
+        Algorithm<cuda::barrier_resource_storage<arena_resource>>> R;
+    R b(17, cuda::std::__empty_completion(), arena_resource{arena, sizeof(arena), &live});
+    assert(live == 1);
+    for (int i = 0; i < 3; ++i) {
+      (void)b.arrive(16);
+      b.arrive_and_wait();
+    }
+  }
+  assert(live == 0);
+}
+
+template<cuda::thread_scope Sco,
+    template<typename, typename> class Selector>
+__host__ __device__
+void test_storage()
+{
+  test<Sco, cuda::barrier_tree, cuda::barrier_inline_storage<9>, Selector>();
+  test<Sco, cuda::barrier_tree, cuda::barrier_inline_storage<64>, Selector>();
+  test<Sco, cuda::barrier_dissemination, cuda::barrier_inline_storage<9>, Selector>();
+  test<Sco, cuda::barrier_dissemination, cuda::barrier_inline_storage<200>, Selector>();
+  test<Sco, cuda::barrier_tournament, cuda::barrier_inline_storage<9>, Selector>();
+  test<Sco, cuda::barrier_tournament, cuda::barrier_inline_storage<64>, Selector>();
+  test<Sco, cuda::barrier_hierarchical, cuda::barrier_inline_storage<9>, Selector>();
+  test<Sco, cuda::barrier_hierarchical, cuda::barrier_inline_storage<64>, Selector>();
+}
+
+template<cuda::thread_scope Sco>
+void test_host_algorithms()
+{
+  test_host<Sco, cuda::barrier_tree>();
+  test_host<Sco, cuda::barrier_dissemination>();
+  test_host<Sco, cuda::barrier_tournament>();
+  test_host<Sco, cuda::barrier_hierarchical>();
+}
+
+template<template<typename, typename> class Selector>
+__host__ __device__
+void test_scopes()
+{
+  test_storage<cuda::thread_scope_system, Selector>();
+  test_storage<cuda::thread_scope_device, Selector>();
+  test_storage<cuda::thread_scope_block, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 9;
+
+      test_scopes<local_memory_selector>();
+      test_host_algorithms<cuda::thread_scope_system>();
+      test_host_algorithms<cuda::thread_scope_device>();
+    ),(
+      test_scopes<shared_memory_selector>();
+      test_scopes<global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/latch>
+
+// cuda::latch<Sco, cuda::latch_hierarchical<Storage>>
+
+#include <cuda/latch>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+struct arena_resource {
+  unsigned char * base;
+  cuda::std::size_t size;
+  int * live;
+
+  void * allocate(cuda::std::size_t bytes, cuda::std::size_t alignment) {
+    assert(bytes <= size);
+    assert(reinterpret_cast<cuda::std::uintptr_t>(base) % alignment == 0);
+    ++*live;
+    return base;
+  }
+  void deallocate(void * p, cuda::std::size_t, cuda::std::size_t) {
+    assert(p == base);
+    --*live;
+  }
+};
+
+template<cuda::thread_scope Sco, class Storage,
+    template<typename, typename> class Selector>
+__host__ __device__
+void test()
+{
+  typedef cuda::latch<Sco, cuda::latch_hierarchical<Storage>> L;
+  Selector<L, constructor_initializer> sel;
+  SHARED L * l;
+  l = sel.construct(5 * 100 + 4);
+
+  // Updates larger than one domain's share spill over into the others.
+  auto counter = LAMBDA () {
+    for (int i = 0; i < 50; ++i) {
+      l->count_down();
+      l->count_down(1);
+    }
+  };
+  auto bulk = LAMBDA () {
+    l->count_down(3);
+    l->arrive_and_wait(1);
+    assert(l->try_wait());
+  };
+
+  concurrent_agents_launch(counter, counter, counter, counter, counter, bulk);
+  assert(l->try_wait());
+  l->wait();
+}
+
+template<cuda::thread_scope Sco>
+void test_host()
+{
+  typedef cuda::latch<Sco, cuda::latch_hierarchical<cuda::barrier_inline_storage<16>>> L;
+  static_assert(L::max() == 16, "");
+
+  {
+    L l(0);
+    assert(l.try_wait());
+    l.wait();
+  }
+  {
+    L l(16);
+    assert(!l.try_wait());
+    l.count_down(15);
+    assert(!l.try_wait());
+    l.arrive_and_wait();
+  }
+
+  alignas(64) unsigned char arena[64 * 64];
+  int live = 0;
+  {
+    typedef cuda::latch<Sco, cuda::latch_hierarchical<cuda::barrier_resource_storage<arena_resource>>> R;
+    R l(1000, arena_resource{arena, sizeof(arena), &live});
+    assert(live == 1);
+    l.count_down(999);
+    assert(!l.try_wait());
+    l.arrive_and_wait();
+  }
+  assert(live == 0);
+}
+
+template<cuda::thread_scope Sco,
+    template<typename, typename> class Selector>
+__host__ __device__
+void test_storage()
+{
+  test<Sco, cuda::barrier_inline_storage<504>, Selector>();
+}
+
+template<template<typename, typename> class Selector>
+__host__ __device__
+void test_scopes()
+{
+  test_storage<cuda::thread_scope_system, Selector>();
+  test_storage<cuda::thread_scope_device, Selector>();
+  test_storage<cuda::thread_scope_block, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 6;
+
+      test_scopes<local_memory_selector>();
+      test_host<cuda::thread_scope_system>();
+      test_host<cuda::thread_scope_device>();
+    ),(
+      test_scopes<shared_memory_selector>();
+      test_scopes<global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,275 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// memcpy_async on the host, through the copy workers
+
+#define _LIBCUDACXX_HOST_MEMCPY_ASYNC_THRESHOLD 4096
+
+#include <cuda/barrier>
+#include <cuda/pipeline>
+#include <cuda/std/barrier>
+
+#include <cstdlib>
+#include <new>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+
+// Set on a thread to make its next allocation throw.
+thread_local bool fail_next_new = false;
+
+void * operator new(size_t size)
+{
+    if (fail_next_new) {
+        fail_next_new = false;
+#ifndef TEST_HAS_NO_EXCEPTIONS
+        throw std::bad_alloc();
+#endif
+    }
+    void * p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr) {
+        std::abort();
+    }
+    return p;
+}
+
+void operator delete(void * p) noexcept
+{
+    std::free(p);
+}
+
+constexpr size_t large = 1 << 20;
+constexpr size_t small = 64;
+
+struct host_group {
+    cuda::std::barrier<> * b;
+    size_t rank;
+    size_t count;
+
+    void sync() const { b->arrive_and_wait(); }
+    size_t size() const { return count; }
+    size_t thread_rank() const { return rank; }
+};
+
+void fill(int * p, size_t n, int seed)
+{
+    for (size_t i = 0; i < n; ++i) {
+        p[i] = seed + static_cast<int>(i);
+    }
+}
+
+bool check(int const * p, size_t n, int seed)
+{
+    for (size_t i = 0; i < n; ++i) {
+        if (p[i] != seed + static_cast<int>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class Barrier>
+void test_barrier()
+{
+    size_t const n = large / sizeof(int);
+    int * src = new int[n];
+    int * dst = new int[n];
+    fill(src, n, 1);
+
+    Barrier b(1);
+    assert(cuda::memcpy_async(dst, src, large, b) == cuda::async_contract_fulfillment::async);
+    b.arrive_and_wait();
+    assert(check(dst, n, 1));
+
+    fill(src, n, 2);
+    assert(cuda::memcpy_async(dst, src, cuda::aligned_size_t<16>(large), b) == cuda::async_contract_fulfillment::async);
+    b.wait(b.arrive());
+    assert(check(dst, n, 2));
+
+    // Small copies are made in place.
+    fill(src, small / sizeof(int), 3);
+    assert(cuda::memcpy_async(dst, src, small, b) == cuda::async_contract_fulfillment::none);
+    assert(check(dst, small / sizeof(int), 3));
+    b.arrive_and_wait();
+
+    delete[] src;
+    delete[] dst;
+}
+
+// Two threads copy alternate 4-byte elements as a group, then both arrive.
+void test_group_barrier()
+{
+    size_t const n = large / sizeof(int);
+    int * src = new int[n];
+    int * dst = new int[n];
+    fill(src, n, 4);
+
+    cuda::barrier<cuda::thread_scope_system> b(2);
+    cuda::std::barrier<> sync(2);
+    auto copier = [&](size_t rank) {
+        host_group g{&sync, rank, 2};
+        assert(cuda::memcpy_async(g, dst, src, large, b) == cuda::async_contract_fulfillment::async);
+        b.arrive_and_wait();
+        assert(check(dst, n, 4));
+    };
+    concurrent_agents_launch([&]() { copier(0); }, [&]() { copier(1); });
+
+    delete[] src;
+    delete[] dst;
+}
+
+// A thread that does not take part in the barrier copies against it before the only
+// participant arrives.
+void test_non_participant()
+{
+    size_t const n = large / sizeof(int);
+    int * src = new int[n];
+    int * dst = new int[n];
+    fill(src, n, 5);
+
+    cuda::barrier<cuda::thread_scope_system> b(1);
+    cuda::std::barrier<> sync(2);
+    auto issuer = [&]() {
+        assert(cuda::memcpy_async(dst, src, large, b) == cuda::async_contract_fulfillment::async);
+        sync.arrive_and_wait();
+    };
+    auto participant = [&]() {
+        sync.arrive_and_wait();
+        b.arrive_and_wait();
+        assert(check(dst, n, 5));
+    };
+    concurrent_agents_launch(issuer, participant);
+
+    delete[] src;
+    delete[] dst;
+}
+
+// A thread that has already arrived copies against the barrier before the other arrives; the
+// phase still includes the copy, although the issuer's next arrival is in a later one.
+void test_issuer_arrived()
+{
+    size_t const n = large / sizeof(int);
+    int * src = new int[n];
+    int * dst = new int[n];
+    fill(src, n, 6);
+
+    cuda::barrier<cuda::thread_scope_system> b(2);
+    cuda::std::barrier<> sync(2);
+    auto issuer = [&]() {
+        auto token = b.arrive();
+        assert(cuda::memcpy_async(dst, src, large, b) == cuda::async_contract_fulfillment::async);
+        sync.arrive_and_wait();
+        b.wait(cuda::std::move(token));
+        assert(check(dst, n, 6));
+    };
+    auto other = [&]() {
+        sync.arrive_and_wait();
+        b.arrive_and_wait();
+        assert(check(dst, n, 6));
+    };
+    concurrent_agents_launch(issuer, other);
+
+    delete[] src;
+    delete[] dst;
+}
+
+// A copy whose allocation fails is not counted against the barrier, which can still complete.
+void test_allocation_failure()
+{
+#ifndef TEST_HAS_NO_EXCEPTIONS
+    size_t const n = large / sizeof(int);
+    int * src = new int[n];
+    int * dst = new int[n];
+    fill(src, n, 7);
+
+    cuda::barrier<cuda::thread_scope_system> b(1);
+    bool thrown = false;
+    try {
+        fail_next_new = true;
+        cuda::memcpy_async(dst, src, large, b);
+    }
+    catch (std::bad_alloc const &) {
+        thrown = true;
+    }
+    fail_next_new = false;
+    assert(thrown);
+    b.arrive_and_wait();
+
+    assert(cuda::memcpy_async(dst, src, large, b) == cuda::async_contract_fulfillment::async);
+    b.arrive_and_wait();
+    assert(check(dst, n, 7));
+
+    delete[] src;
+    delete[] dst;
+#endif
+}
+
+// A producer streams blocks through a two-stage pipeline to a consumer; each commit leaves the
+// arrival to the copy workers.
+template <cuda::thread_scope Scope>
+void test_pipeline()
+{
+    constexpr int blocks = 8;
+    size_t const n = large / sizeof(int);
+    int * src = new int[n * blocks];
+    int * dst = new int[n * 2];
+    for (int i = 0; i < blocks; ++i) {
+        fill(src + i * n, n, 10 * i);
+    }
+
+    cuda::pipeline_shared_state<Scope, 2> state;
+    cuda::std::barrier<> sync(2);
+    auto producer = [&]() {
+        host_group g{&sync, 0, 2};
+        auto pipe = cuda::make_pipeline(g, &state, cuda::pipeline_role::producer);
+        for (int i = 0; i < blocks; ++i) {
+            pipe.producer_acquire();
+            cuda::memcpy_async(dst + (i % 2) * n, src + i * n, large, pipe);
+            pipe.producer_commit();
+        }
+        pipe.quit();
+    };
+    auto consumer = [&]() {
+        host_group g{&sync, 1, 2};
+        auto pipe = cuda::make_pipeline(g, &state, cuda::pipeline_role::consumer);
+        for (int i = 0; i < blocks; ++i) {
+            pipe.consumer_wait();
+            assert(check(dst + (i % 2) * n, n, 10 * i));
+            pipe.consumer_release();
+        }
+        pipe.quit();
+    };
+    concurrent_agents_launch(producer, consumer);
+
+    delete[] src;
+    delete[] dst;
+}
+
+int main(int, char**)
+{
+    NV_IF_TARGET(NV_IS_HOST,(
+      test_barrier<cuda::barrier<cuda::thread_scope_system>>();
+      test_barrier<cuda::barrier<cuda::thread_scope_block>>();
+      test_barrier<cuda::barrier<cuda::thread_scope_device>>();
+
+      test_group_barrier();
+      test_non_participant();
+      test_issuer_arrived();
+      test_allocation_failure();
+
+      test_pipeline<cuda::thread_scope_system>();
+      test_pipeline<cuda::thread_scope_block>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+// UNSUPPORTED: c++11, nvrtc
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// memcpy_async between mdspans
+
+#define _LIBCUDACXX_HOST_MEMCPY_ASYNC_THRESHOLD 4096
+
+#include <cuda/barrier>
+#include <cuda/pipeline>
+#include <cuda/std/mdspan>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+
+using index_t = size_t;
+constexpr size_t dyn = cuda::std::dynamic_extent;
+using extents2 = cuda::std::dextents<index_t, 2>;
+using strided2 = cuda::std::layout_stride::mapping<extents2>;
+
+constexpr int rows = 24;
+constexpr int cols = 40;
+
+__host__ __device__
+int value(int i, int j)
+{
+    return i * 1000 + j;
+}
+
+__host__ __device__
+void fill(int * matrix)
+{
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            matrix[i * cols + j] = value(i, j);
+        }
+    }
+}
+
+// A tile of a row-major matrix, into a row-major tile, a column-major tile, and a transposed
+// strided one.
+template <class Sync>
+__host__ __device__
+void test_tiles(Sync & sync, void (*complete)(Sync &))
+{
+    int matrix[rows * cols];
+    int tile[8 * 12];
+    fill(matrix);
+
+    cuda::std::mdspan<int const, extents2, cuda::std::layout_stride> src(
+        matrix + 4 * cols + 6, strided2(extents2(8, 12), cuda::std::array<index_t, 2>{cols, 1}));
+
+    {
+        cuda::std::mdspan<int, cuda::std::extents<index_t, 8, 12>> dst(tile);
+        cuda::memcpy_async(dst, src, sync);
+        complete(sync);
+        for (int i = 0; i < 8; ++i) {
+            for (int j = 0; j < 12; ++j) {
+                assert(tile[i * 12 + j] == value(4 + i, 6 + j));
+            }
+        }
+    }
+    {
+        cuda::std::mdspan<int, cuda::std::extents<index_t, 8, dyn>, cuda::std::layout_left> dst(tile, 12);
+        cuda::memcpy_async(dst, src, sync);
+        complete(sync);
+        for (int i = 0; i < 8; ++i) {
+            for (int j = 0; j < 12; ++j) {
+                assert(tile[j * 8 + i] == value(4 + i, 6 + j));
+            }
+        }
+    }
+    {
+        cuda::std::mdspan<int, extents2, cuda::std::layout_stride> dst(
+            tile, strided2(extents2(8, 12), cuda::std::array<index_t, 2>{1, 8}));
+        cuda::memcpy_async(dst, src, sync);
+        complete(sync);
+        for (int i = 0; i < 8; ++i) {
+            for (int j = 0; j < 12; ++j) {
+                assert(tile[j * 8 + i] == value(4 + i, 6 + j));
+            }
+        }
+    }
+}
+
+// Whole matrices, which are one contiguous run, and a rank-3 gather of every other row.
+template <class Sync>
+__host__ __device__
+void test_shapes(Sync & sync, void (*complete)(Sync &))
+{
+    int matrix[rows * cols];
+    int copy[rows * cols];
+    fill(matrix);
+
+    {
+        cuda::std::mdspan<int const, cuda::std::extents<index_t, rows, cols>> src(matrix);
+        cuda::std::mdspan<int, extents2> dst(copy, rows, cols);
+        cuda::memcpy_async(dst, src, sync);
+        complete(sync);
+        for (int k = 0; k < rows * cols; ++k) {
+            assert(copy[k] == matrix[k]);
+        }
+    }
+    {
+        using extents3 = cuda::std::dextents<index_t, 3>;
+        cuda::std::mdspan<int const, extents3, cuda::std::layout_stride> src(
+            matrix, cuda::std::layout_stride::mapping<extents3>(
+                extents3(3, rows / 6, cols), cuda::std::array<index_t, 3>{2 * cols * (rows / 6), 2 * cols, 1}));
+        cuda::std::mdspan<int, extents3> dst(copy, 3, rows / 6, cols);
+        cuda::memcpy_async(dst, src, sync);
+        complete(sync);
+        for (int i = 0; i < rows / 2; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                assert(copy[i * cols + j] == value(2 * i, j));
+            }
+        }
+    }
+    {
+        cuda::std::mdspan<int const, extents2> src(matrix, 0, cols);
+        cuda::std::mdspan<int, extents2> dst(copy, 0, cols);
+        assert(cuda::memcpy_async(dst, src, sync) == cuda::async_contract_fulfillment::none);
+        complete(sync);
+    }
+}
+
+template <class Barrier>
+__host__ __device__
+void barrier_complete(Barrier & b)
+{
+    b.arrive_and_wait();
+}
+
+__host__ __device__
+void pipeline_complete(cuda::pipeline<cuda::thread_scope_thread> & pipe)
+{
+    pipe.producer_commit();
+    pipe.consumer_wait();
+    pipe.consumer_release();
+    pipe.producer_acquire();
+}
+
+template <class Barrier>
+__host__ __device__
+void test_barrier()
+{
+    Barrier b(1);
+    test_tiles<Barrier>(b, barrier_complete<Barrier>);
+    test_shapes<Barrier>(b, barrier_complete<Barrier>);
+}
+
+__host__ __device__
+void test_pipeline()
+{
+    cuda::pipeline<cuda::thread_scope_thread> pipe = cuda::make_pipeline();
+    pipe.producer_acquire();
+    test_tiles(pipe, pipeline_complete);
+    test_shapes(pipe, pipeline_complete);
+    pipe.producer_commit();
+}
+
+// Two threads gather the columns of a large tile through the copy workers, sharing out the rows.
+void test_host_group()
+{
+    constexpr size_t n = 512;
+    int * matrix = new int[n * n];
+    int * tile = new int[(n / 2) * (n / 2)];
+    for (size_t k = 0; k < n * n; ++k) {
+        matrix[k] = static_cast<int>(k);
+    }
+
+    cuda::std::mdspan<int const, extents2, cuda::std::layout_stride> src(
+        matrix + n / 4, strided2(extents2(n / 2, n / 2), cuda::std::array<index_t, 2>{n, 1}));
+    cuda::std::mdspan<int, extents2> dst(tile, n / 2, n / 2);
+
+    cuda::barrier<cuda::thread_scope_system> b(2);
+    cuda::host_thread_group::shared_state group_state(2);
+    auto copier = [&](size_t rank) {
+        cuda::host_thread_group g(group_state, rank);
+        assert(cuda::memcpy_async(g, dst, src, b) == cuda::async_contract_fulfillment::async);
+        b.arrive_and_wait();
+        for (size_t i = 0; i < n / 2; ++i) {
+            for (size_t j = 0; j < n / 2; ++j) {
+                assert(tile[i * (n / 2) + j] == static_cast<int>(i * n + n / 4 + j));
+            }
+        }
+    };
+    concurrent_agents_launch([&]() { copier(0); }, [&]() { copier(1); });
+
+    delete[] matrix;
+    delete[] tile;
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      test_barrier<cuda::barrier<cuda::thread_scope_system>>();
+      test_barrier<cuda::barrier<cuda::thread_scope_block>>();
+      test_pipeline();
+
+      test_host_group();
+    ),(
+      test_barrier<cuda::barrier<cuda::thread_scope_block>>();
+      test_pipeline();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+// UNSUPPORTED: nvrtc
+
+// memcpy_async on the host into a destination annotated access_property::streaming
+
+#define _LIBCUDACXX_HOST_MEMCPY_ASYNC_THRESHOLD 4096
+#define _LIBCUDACXX_HOST_MEMCPY_STREAMING_THRESHOLD 1024
+#define _LIBCUDACXX_ENABLE_PIPELINE_STATS
+
+#include <cuda/annotated_ptr>
+#include <cuda/barrier>
+#include <cuda/pipeline>
+
+#include "test_macros.h"
+
+constexpr size_t large = 1 << 20;
+constexpr size_t n = large / sizeof(int);
+
+alignas(64) int src[n];
+alignas(64) int dst[n];
+
+typedef cuda::annotated_ptr<int, cuda::access_property::streaming> streaming_ptr;
+typedef cuda::annotated_ptr<int const, cuda::access_property::normal> normal_ptr;
+
+void fill(int * p, size_t count, int seed)
+{
+    for (size_t i = 0; i < count; ++i) {
+        p[i] = seed + static_cast<int>(i);
+    }
+}
+
+bool check(int const * p, size_t count, int seed)
+{
+    for (size_t i = 0; i < count; ++i) {
+        if (p[i] != seed + static_cast<int>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_barrier()
+{
+    cuda::barrier<cuda::thread_scope_system> b(1);
+
+    fill(src, n, 1);
+    cuda::memcpy_async(streaming_ptr(dst), normal_ptr(src), cuda::aligned_size_t<16>(large), b);
+    b.arrive_and_wait();
+    assert(check(dst, n, 1));
+
+    // A destination off a cache line boundary, and a length that does not end on one.
+    size_t const offset = 4;
+    size_t const count = n - 3 * offset;
+    fill(dst, n, 0);
+    fill(src, n, 2);
+    cuda::memcpy_async(streaming_ptr(dst + offset), normal_ptr(src + offset),
+                       cuda::aligned_size_t<16>(count * sizeof(int)), b);
+    b.arrive_and_wait();
+    assert(check(dst, offset, 0));
+    assert(check(dst + offset, count, 2 + static_cast<int>(offset)));
+    assert(check(dst + offset + count, n - offset - count, static_cast<int>(offset + count)));
+
+    // Without an alignment of 16 bytes, the hint is ignored.
+    fill(src, n, 3);
+    cuda::memcpy_async(streaming_ptr(dst + 1), normal_ptr(src), (n - 1) * sizeof(int), b);
+    b.arrive_and_wait();
+    assert(check(dst + 1, n - 1, 3));
+
+    // Small copies are made in place.
+    fill(src, 16, 4);
+    cuda::memcpy_async(streaming_ptr(dst), normal_ptr(src), cuda::aligned_size_t<16>(16 * sizeof(int)), b);
+    assert(check(dst, 16, 4));
+    b.arrive_and_wait();
+}
+
+void test_pipeline()
+{
+    cuda::pipeline<cuda::thread_scope_thread> pipe = cuda::make_pipeline();
+
+    for (int i = 0; i < 4; ++i) {
+        fill(src, n, 10 * i);
+        pipe.producer_acquire();
+        cuda::memcpy_async(streaming_ptr(dst), normal_ptr(src), cuda::aligned_size_t<16>(large), pipe);
+        pipe.producer_commit();
+        pipe.consumer_wait();
+        assert(check(dst, n, 10 * i));
+        pipe.consumer_release();
+    }
+}
+
+// Streaming copies count towards the bytes of a pipeline's statistics.
+void test_pipeline_stats()
+{
+    typedef cuda::pipeline_shared_state<cuda::thread_scope_system, 2> state_t;
+    state_t * state = new state_t;
+    cuda::host_thread_group::shared_state group_state(1);
+    cuda::host_thread_group g(group_state, 0);
+    cuda::pipeline<cuda::thread_scope_system> pipe = cuda::make_pipeline(g, state);
+
+    fill(src, n, 5);
+    pipe.producer_acquire();
+    cuda::memcpy_async(g, streaming_ptr(dst), normal_ptr(src), cuda::aligned_size_t<16>(large), pipe);
+    pipe.producer_commit();
+    pipe.consumer_wait();
+    assert(check(dst, n, 5));
+    pipe.consumer_release();
+    pipe.quit();
+
+    assert(cuda::pipeline_stats_snapshot(*state).bytes == large);
+    delete state;
+}
+
+int main(int, char**)
+{
+    NV_IF_TARGET(NV_IS_HOST,(
+      test_barrier();
+      test_pipeline();
+      test_pipeline_stats();
+    ))
+
+    return 0;
+}
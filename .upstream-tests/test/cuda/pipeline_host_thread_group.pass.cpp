@@ -0,0 +1,152 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+// UNSUPPORTED: nvrtc
+
+// Pipelines shared by the host threads of a cuda::host_thread_group
+
+#define _LIBCUDACXX_HOST_MEMCPY_ASYNC_THRESHOLD 4096
+
+#include <cuda/pipeline>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+
+constexpr int stages = 3;
+constexpr int steps = 10;
+constexpr size_t batch = 16 * 1024 / sizeof(int);
+
+typedef cuda::pipeline_shared_state<cuda::thread_scope_system, stages> state_t;
+
+int * src;
+int * dst;
+
+void fill()
+{
+    for (size_t i = 0; i < steps * batch; ++i) {
+        src[i] = static_cast<int>(i);
+    }
+}
+
+// The batch of step i is in the buffer of its stage.
+void check(int i)
+{
+    int const * const stage = dst + (i % stages) * batch;
+    for (size_t k = 0; k < batch; ++k) {
+        assert(stage[k] == static_cast<int>(i * batch + k));
+    }
+}
+
+void produce(cuda::host_thread_group const & g, cuda::pipeline<cuda::thread_scope_system> & pipe, int i)
+{
+    pipe.producer_acquire();
+    cuda::memcpy_async(g, dst + (i % stages) * batch, src + i * batch, batch * sizeof(int), pipe);
+    pipe.producer_commit();
+}
+
+void consume(cuda::pipeline<cuda::thread_scope_system> & pipe, int i)
+{
+    pipe.consumer_wait();
+    check(i);
+    pipe.consumer_release();
+}
+
+// Every thread both produces, copying its share of each batch, and consumes, keeping the
+// pipeline a stage short of full.
+void test_unified(state_t & state)
+{
+    cuda::host_thread_group::shared_state group_state(4);
+    auto agent = [&](size_t rank) {
+        cuda::host_thread_group g(group_state, rank);
+        assert(g.size() == 4);
+        assert(g.thread_rank() == rank);
+        cuda::pipeline<cuda::thread_scope_system> pipe = cuda::make_pipeline(g, &state);
+        for (int i = 0; i < steps; ++i) {
+            produce(g, pipe, i);
+            if (i >= stages - 1) {
+                consume(pipe, i - (stages - 1));
+            }
+        }
+        for (int i = steps - (stages - 1); i < steps; ++i) {
+            consume(pipe, i);
+        }
+        pipe.quit();
+    };
+    concurrent_agents_launch([&]() { agent(0); }, [&]() { agent(1); }, [&]() { agent(2); }, [&]() { agent(3); });
+}
+
+// The first two threads produce, as a group of their own, for the other two.
+void test_partitioned(state_t & state)
+{
+    cuda::host_thread_group::shared_state group_state(4);
+    cuda::host_thread_group::shared_state producer_state(2);
+    auto agent = [&](size_t rank) {
+        cuda::host_thread_group g(group_state, rank);
+        cuda::pipeline<cuda::thread_scope_system> pipe = cuda::make_pipeline(g, &state, 2);
+        if (rank < 2) {
+            cuda::host_thread_group producers(producer_state, rank);
+            for (int i = 0; i < steps; ++i) {
+                produce(producers, pipe, i);
+            }
+        }
+        else {
+            for (int i = 0; i < steps; ++i) {
+                consume(pipe, i);
+            }
+        }
+    };
+    concurrent_agents_launch([&]() { agent(0); }, [&]() { agent(1); }, [&]() { agent(2); }, [&]() { agent(3); });
+}
+
+// One thread produces alone for three consumers.
+void test_roles(state_t & state)
+{
+    cuda::host_thread_group::shared_state group_state(4);
+    cuda::host_thread_group::shared_state producer_state(1);
+    auto agent = [&](size_t rank) {
+        cuda::host_thread_group g(group_state, rank);
+        const cuda::pipeline_role role = rank == 3 ? cuda::pipeline_role::producer : cuda::pipeline_role::consumer;
+        cuda::pipeline<cuda::thread_scope_system> pipe = cuda::make_pipeline(g, &state, role);
+        if (role == cuda::pipeline_role::producer) {
+            cuda::host_thread_group producer(producer_state, 0);
+            for (int i = 0; i < steps; ++i) {
+                produce(producer, pipe, i);
+            }
+        }
+        else {
+            for (int i = 0; i < steps; ++i) {
+                consume(pipe, i);
+            }
+        }
+    };
+    concurrent_agents_launch([&]() { agent(0); }, [&]() { agent(1); }, [&]() { agent(2); }, [&]() { agent(3); });
+}
+
+int main(int, char**)
+{
+    NV_IF_TARGET(NV_IS_HOST,(
+      src = new int[steps * batch];
+      dst = new int[stages * batch];
+      fill();
+      state_t * state = new state_t;
+
+      test_unified(*state);
+      test_partitioned(*state);
+      test_roles(*state);
+
+      delete state;
+      delete[] dst;
+      delete[] src;
+    ))
+
+    return 0;
+}
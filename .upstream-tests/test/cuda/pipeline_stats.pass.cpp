@@ -0,0 +1,151 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+// UNSUPPORTED: nvrtc
+
+// Stall, byte and occupancy counters of pipelines, with _LIBCUDACXX_ENABLE_PIPELINE_STATS
+
+#define _LIBCUDACXX_ENABLE_PIPELINE_STATS
+
+#include <cuda/pipeline>
+
+#include <chrono>
+#include <thread>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+
+constexpr int stages = 2;
+constexpr int steps = 16;
+constexpr size_t chunk = 256;
+
+typedef cuda::pipeline_shared_state<cuda::thread_scope_system, stages> state_t;
+
+char src[steps * chunk];
+char dst[steps * chunk];
+
+// One producer and one consumer thread pass steps chunks through the pipeline, the one named
+// slow sleeping for a while on each.
+void run(state_t & state, bool slow_producer)
+{
+    cuda::host_thread_group::shared_state group_state(2);
+    auto producer = [&]() {
+        cuda::host_thread_group g(group_state, 0);
+        cuda::pipeline<cuda::thread_scope_system> pipe = cuda::make_pipeline(g, &state, cuda::pipeline_role::producer);
+        for (int i = 0; i < steps; ++i) {
+            pipe.producer_acquire();
+            if (slow_producer) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            cuda::memcpy_async(dst + i * chunk, src + i * chunk, chunk, pipe);
+            pipe.producer_commit();
+        }
+    };
+    auto consumer = [&]() {
+        cuda::host_thread_group g(group_state, 1);
+        cuda::pipeline<cuda::thread_scope_system> pipe = cuda::make_pipeline(g, &state, cuda::pipeline_role::consumer);
+        for (int i = 0; i < steps; ++i) {
+            pipe.consumer_wait();
+            assert(dst[i * chunk] == static_cast<char>(i));
+            if (!slow_producer) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            pipe.consumer_release();
+        }
+    };
+    concurrent_agents_launch(producer, consumer);
+}
+
+void check_counts(cuda::pipeline_stage_stats const & s)
+{
+    assert(s.producer_acquires == steps);
+    assert(s.consumer_waits == steps);
+    assert(s.bytes == steps * chunk);
+    assert(s.producer_stalls <= s.producer_acquires);
+    assert(s.consumer_stalls <= s.consumer_waits);
+    assert(s.occupancy <= s.consumer_waits * stages);
+}
+
+void test_consumer_bound(state_t & state)
+{
+    run(state, false);
+    cuda::pipeline_stage_stats const s = cuda::pipeline_stats_snapshot(state);
+    check_counts(s);
+    assert(s.producer_stalls > 0);
+    assert(s.producer_stall_ns > s.consumer_stall_ns);
+
+    cuda::pipeline_stage_stats const s0 = cuda::pipeline_stats_snapshot(state, 0);
+    cuda::pipeline_stage_stats const s1 = cuda::pipeline_stats_snapshot(state, 1);
+    assert(s0.bytes == steps / stages * chunk);
+    assert(s0.bytes + s1.bytes == s.bytes);
+    assert(s0.producer_acquires + s1.producer_acquires == s.producer_acquires);
+}
+
+void test_producer_bound(state_t & state)
+{
+    run(state, true);
+    cuda::pipeline_stage_stats const s = cuda::pipeline_stats_snapshot(state);
+    check_counts(s);
+    assert(s.consumer_stalls > 0);
+    assert(s.consumer_stall_ns > s.producer_stall_ns);
+    assert(s.occupancy < s.consumer_waits * stages);
+}
+
+void test_reset(state_t & state)
+{
+    cuda::pipeline_stats_reset(state);
+    cuda::pipeline_stage_stats const s = cuda::pipeline_stats_snapshot(state);
+    assert(s.producer_acquires == 0 && s.producer_stalls == 0 && s.producer_stall_ns == 0);
+    assert(s.consumer_waits == 0 && s.consumer_stalls == 0 && s.consumer_stall_ns == 0);
+    assert(s.bytes == 0 && s.occupancy == 0);
+}
+
+// A single thread producing ahead finds every stage it committed produced.
+void test_occupancy(state_t & state)
+{
+    cuda::host_thread_group::shared_state group_state(1);
+    cuda::host_thread_group g(group_state, 0);
+    cuda::pipeline<cuda::thread_scope_system> pipe = cuda::make_pipeline(g, &state);
+    for (int i = 0; i < stages; ++i) {
+        pipe.producer_acquire();
+        cuda::memcpy_async(g, static_cast<void *>(dst), static_cast<void const *>(src), cuda::aligned_size_t<16>(chunk), pipe);
+        pipe.producer_commit();
+    }
+    for (int i = 0; i < stages; ++i) {
+        pipe.consumer_wait();
+        pipe.consumer_release();
+    }
+    cuda::pipeline_stage_stats const s = cuda::pipeline_stats_snapshot(state);
+    assert(s.consumer_waits == stages);
+    assert(s.consumer_stalls == 0);
+    assert(s.occupancy == stages + (stages - 1));
+    assert(s.bytes == stages * chunk);
+}
+
+int main(int, char**)
+{
+    NV_IF_TARGET(NV_IS_HOST,(
+      for (size_t i = 0; i < sizeof(src); ++i) {
+          src[i] = static_cast<char>(i / chunk);
+      }
+      state_t * state = new state_t;
+
+      test_consumer_bound(*state);
+      test_producer_bound(*state);
+      test_reset(*state);
+      test_occupancy(*state);
+
+      delete state;
+    ))
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/mutex>
+
+// cuda::mcs_lock<Sco, PoolNodes>
+// cuda::clh_lock<Sco, PoolNodes>
+
+#include <cuda/mutex>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Lock,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test()
+{
+  struct guarded {
+    Lock m;
+    int count;
+  };
+
+  Selector<guarded, default_initializer> sel;
+  SHARED guarded * g;
+  g = sel.construct();
+
+  execute_on_main_thread([&]{
+    g->count = 0;
+    assert(g->m.try_lock());
+    assert(!g->m.try_lock());
+    g->m.unlock();
+    g->m.lock();
+    assert(!g->m.try_lock());
+    g->m.unlock();
+  });
+
+  auto incrementer = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      g->m.lock();
+      ++g->count;
+      g->m.unlock();
+    }
+  };
+  auto guarded_incrementer = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      cuda::std::lock_guard<Lock> lk(g->m);
+      ++g->count;
+    }
+  };
+  auto trying_incrementer = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      while (!g->m.try_lock()) {}
+      ++g->count;
+      g->m.unlock();
+    }
+  };
+
+  concurrent_agents_launch(incrementer, guarded_incrementer, trying_incrementer);
+
+  execute_on_main_thread([&]{
+    assert(g->count == 3000);
+    assert(g->m.try_lock());
+    g->m.unlock();
+  });
+}
+
+// Nodes supplied by each thread from its own stack.
+template<cuda::thread_scope Sco>
+void test_stack_nodes()
+{
+  typedef cuda::mcs_lock<Sco, 1> Lock;
+  Lock m;
+  int count = 0;
+
+  {
+    typename Lock::node n;
+    assert(m.try_lock(n));
+    typename Lock::node other;
+    assert(!m.try_lock(other));
+    m.unlock(n);
+    assert(m.try_lock(other));
+    m.unlock(other);
+  }
+
+  auto incrementer = [&](){
+    for (int i = 0; i < 1000; ++i) {
+      typename Lock::node n;
+      m.lock(n);
+      ++count;
+      m.unlock(n);
+    }
+  };
+  auto pooled_incrementer = [&](){
+    for (int i = 0; i < 1000; ++i) {
+      m.lock();
+      ++count;
+      m.unlock();
+    }
+  };
+  concurrent_agents_launch(incrementer, incrementer, pooled_incrementer);
+
+  assert(count == 3000);
+}
+
+// Threads that only try a CLH lock race threads that lock it, and so recycle the tail's node,
+// without ever holding the lock together with another thread.
+template<cuda::thread_scope Sco>
+void test_clh_try_lock()
+{
+  cuda::clh_lock<Sco, 4> m;
+  cuda::std::atomic<int> holders(0);
+  int count = 0;
+
+  auto hold = [&](){
+    assert(holders.fetch_add(1) == 0);
+    ++count;
+    holders.fetch_sub(1);
+  };
+  auto locker = [&](){
+    for (int i = 0; i < 10000; ++i) {
+      m.lock();
+      hold();
+      m.unlock();
+    }
+  };
+  auto trier = [&](){
+    for (int i = 0; i < 10000; ++i) {
+      while (!m.try_lock()) {}
+      hold();
+      m.unlock();
+    }
+  };
+  concurrent_agents_launch(locker, locker, trier, trier);
+
+  assert(count == 40000);
+  assert(m.try_lock());
+  m.unlock();
+}
+
+template<cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test_locks()
+{
+  test<cuda::mcs_lock<Sco, 1>, Selector>();
+  test<cuda::mcs_lock<Sco, 4>, Selector>();
+  test<cuda::clh_lock<Sco, 1>, Selector>();
+  test<cuda::clh_lock<Sco, 4>, Selector>();
+}
+
+template<template<typename, typename> typename Selector>
+__host__ __device__
+void test_scopes()
+{
+  test_locks<cuda::thread_scope_system, Selector>();
+  test_locks<cuda::thread_scope_device, Selector>();
+  test_locks<cuda::thread_scope_block, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 3;
+
+      test_scopes<local_memory_selector>();
+
+      test_stack_nodes<cuda::thread_scope_system>();
+      test_stack_nodes<cuda::thread_scope_device>();
+
+      test_clh_try_lock<cuda::thread_scope_system>();
+    ),(
+      test_scopes<shared_memory_selector>();
+      test_scopes<global_memory_selector>();
+    ))
+
+    return 0;
+}
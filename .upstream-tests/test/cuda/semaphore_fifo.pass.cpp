@@ -0,0 +1,134 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/semaphore>
+
+// cuda::counting_semaphore<Sco, least_max_value, cuda::semaphore_fifo<Slots>>
+
+#include <cuda/semaphore>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<cuda::thread_scope Sco, int Slots,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test()
+{
+  typedef cuda::counting_semaphore<Sco, 64, cuda::semaphore_fifo<Slots>> S;
+  Selector<S, constructor_initializer> sel;
+  SHARED S * s;
+  s = sel.construct(5);
+
+  execute_on_main_thread([&]{
+    assert(!s->try_acquire(6));
+    assert(s->try_acquire(3));
+    assert(!s->try_acquire(3));
+    assert(!s->try_acquire_for(3, cuda::std::chrono::milliseconds(1)));
+    assert(s->try_acquire_for(2, cuda::std::chrono::milliseconds(0)));
+    assert(!s->try_acquire());
+  });
+
+  auto taker = LAMBDA (){
+    for (int i = 0; i < 100; ++i) {
+      s->acquire(3);
+      s->release(3);
+    }
+  };
+  auto releaser = LAMBDA (){
+    s->release(4);
+    for (int i = 0; i < 100; ++i) {
+      s->acquire();
+      s->release();
+    }
+  };
+  concurrent_agents_launch(taker, releaser, taker);
+
+  execute_on_main_thread([&]{
+    s->acquire(4);
+    assert(!s->try_acquire());
+  });
+}
+
+template<cuda::thread_scope Sco, int Slots>
+void test_order()
+{
+  typedef cuda::counting_semaphore<Sco, 64, cuda::semaphore_fifo<Slots>> S;
+  S s(0);
+  int order[3] = {-1, -1, -1};
+  cuda::std::atomic<int> served(0);
+
+  // The acquirers queue up 50ms apart, the first asking for two units.
+  auto acquirer = [&](int i, int n){
+    std::this_thread::sleep_for(std::chrono::milliseconds(50 * i));
+    s.acquire(n);
+    order[served++] = i;
+  };
+  auto releaser = [&](){
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    // A queued acquirer is first in line for each unit released, so
+    // nobody can take the units ahead of it.
+    s.release(1);
+    assert(!s.try_acquire());
+    s.release(1);
+    assert(!s.try_acquire());
+    while (served.load() != 1) {}
+    s.release(1);
+    while (served.load() != 2) {}
+    s.release(1);
+  };
+  concurrent_agents_launch([&](){ acquirer(0, 2); }, [&](){ acquirer(1, 1); },
+                           [&](){ acquirer(2, 1); }, releaser);
+
+  assert(order[0] == 0 && order[1] == 1 && order[2] == 2);
+  assert(!s.try_acquire());
+}
+
+template<cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test_slots()
+{
+  test<Sco, 1, Selector>();
+  test<Sco, 32, Selector>();
+}
+
+template<template<typename, typename> typename Selector>
+__host__ __device__
+void test_scopes()
+{
+  test_slots<cuda::thread_scope_system, Selector>();
+  test_slots<cuda::thread_scope_device, Selector>();
+  test_slots<cuda::thread_scope_block, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 3;
+
+      test_scopes<local_memory_selector>();
+
+      cuda_thread_count = 4;
+
+      test_order<cuda::thread_scope_system, 1>();
+      test_order<cuda::thread_scope_system, 32>();
+      test_order<cuda::thread_scope_device, 2>();
+    ),(
+      test_scopes<shared_memory_selector>();
+      test_scopes<global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/atomic>
+
+// cuda::sharded_counter<T>
+
+#include <cuda/atomic>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template <class T, cuda::thread_scope Sco, size_t Shards,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test()
+{
+  typedef cuda::sharded_counter<T, Sco, Shards> C;
+  static_assert(C::shard_count == Shards, "");
+
+  Selector<C, constructor_initializer> sel;
+  SHARED C * c;
+  c = sel.construct(T(5), 16);
+
+  assert(c->load() == T(5));
+  assert(c->load_approx() == T(5));
+
+  auto adder = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      c->add(T(3));
+    }
+  };
+  auto subber = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      c->add(T(2));
+      c->sub(T(1));
+    }
+  };
+
+  concurrent_agents_launch(adder, subber);
+
+  assert(c->load() == T(4005));
+  assert(T(*c) == T(4005));
+  // Every slot holds less than one batch once the updates are quiescent.
+  assert(T(c->load() - c->load_approx()) < T(16 * Shards));
+
+  // Updates of at least one batch go straight to the total.
+  T const approx = c->load_approx();
+  c->add(T(100));
+  assert(c->load_approx() == T(approx + 100));
+  c->sub(T(105));
+  assert(c->load() == T(4000));
+
+  c->reset();
+  assert(c->load() == T(0) && c->load_approx() == T(0));
+  c->reset(T(7));
+  assert(c->load() == T(7));
+}
+
+template <cuda::thread_scope Sco,
+    template<typename, typename> typename Selector>
+__host__ __device__
+void test_types()
+{
+  test<unsigned long long, Sco, 64, Selector>();
+  test<int, Sco, 4, Selector>();
+  test<unsigned, Sco, 1, Selector>();
+}
+
+template <template<typename, typename> typename Selector>
+__host__ __device__
+void test_scopes()
+{
+  test_types<cuda::thread_scope_system, Selector>();
+  test_types<cuda::thread_scope_device, Selector>();
+  test_types<cuda::thread_scope_block, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 2;
+
+      test_scopes<local_memory_selector>();
+    ),(
+      test_scopes<global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+// UNSUPPORTED: nvrtc
+
+// <cuda/atomic>
+
+// cuda::wait_stats_snapshot, cuda::wait_stats_reset
+
+#define _LIBCUDACXX_ENABLE_WAIT_STATS
+
+#include <cuda/atomic>
+#include <cuda/barrier>
+#include <cuda/latch>
+#include <cuda/semaphore>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+
+void check_zero(cuda::wait_site site)
+{
+  cuda::wait_stats const s = cuda::wait_stats_snapshot(site);
+  assert(s.spins == 0 && s.slow_paths == 0 && s.sleep_ns == 0);
+  assert(s.wakeups == 0 && s.spurious_wakeups == 0);
+  assert(s.notifies == 0 && s.idle_notifies == 0);
+}
+
+void test_atomic()
+{
+  cuda::wait_stats_reset();
+  check_zero(cuda::wait_site::atomic);
+
+  cuda::std::atomic<int> a(0);
+  a.notify_one();
+  cuda::wait_stats s = cuda::wait_stats_snapshot(cuda::wait_site::atomic);
+  assert(s.notifies == 1 && s.idle_notifies == 1);
+
+  // A wait on a value that already changed returns without spinning.
+  a.wait(1);
+  assert(cuda::wait_stats_snapshot(cuda::wait_site::atomic).slow_paths == 0);
+
+  auto waiter = [&](){
+    a.wait(0);
+  };
+  auto notifier = [&](){
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    a.store(1);
+    a.notify_all();
+  };
+  concurrent_agents_launch(waiter, notifier);
+
+  s = cuda::wait_stats_snapshot(cuda::wait_site::atomic);
+  assert(s.spins > 0);
+  assert(s.slow_paths == 1);
+  assert(s.wakeups == 1);
+  assert(s.sleep_ns > 0);
+  assert(s.notifies == 2);
+
+  check_zero(cuda::wait_site::barrier);
+  check_zero(cuda::wait_site::latch);
+  check_zero(cuda::wait_site::semaphore);
+}
+
+void test_barrier()
+{
+  cuda::wait_stats_reset();
+
+  cuda::barrier<cuda::thread_scope_system> b(2);
+  auto worker = [&](){
+    for (int i = 0; i < 10; ++i) {
+      b.arrive_and_wait();
+    }
+  };
+  concurrent_agents_launch(worker, worker);
+
+  cuda::wait_stats s = cuda::wait_stats_snapshot(cuda::wait_site::barrier);
+  assert(s.notifies >= 10);
+  check_zero(cuda::wait_site::atomic);
+
+  // A waiter that outlasts the spin blocks once and is woken by the last
+  // arrival, rather than polling on a timer.
+  cuda::wait_stats_reset();
+  cuda::barrier<cuda::thread_scope_device> d(2);
+  auto waiter = [&](){
+    d.arrive_and_wait();
+  };
+  auto late = [&](){
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    d.arrive_and_wait();
+  };
+  concurrent_agents_launch(waiter, late);
+
+  s = cuda::wait_stats_snapshot(cuda::wait_site::barrier);
+  assert(s.slow_paths == 1 && s.wakeups == 1);
+  assert(s.spurious_wakeups == 0);
+  assert(s.notifies == 1);
+}
+
+void test_latch()
+{
+  cuda::wait_stats_reset();
+
+  cuda::latch<cuda::thread_scope_system> l(1);
+  auto waiter = [&](){
+    l.wait();
+  };
+  auto counter = [&](){
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    l.count_down();
+  };
+  concurrent_agents_launch(waiter, counter);
+
+  cuda::wait_stats const s = cuda::wait_stats_snapshot(cuda::wait_site::latch);
+  assert(s.slow_paths == 1 && s.wakeups == 1);
+  assert(s.notifies == 1);
+  check_zero(cuda::wait_site::atomic);
+}
+
+void test_semaphore()
+{
+  cuda::wait_stats_reset();
+
+  cuda::counting_semaphore<cuda::thread_scope_system> sem(0);
+  auto waiter = [&](){
+    sem.acquire();
+  };
+  auto releaser = [&](){
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    sem.release();
+  };
+  concurrent_agents_launch(waiter, releaser);
+
+  cuda::wait_stats s = cuda::wait_stats_snapshot(cuda::wait_site::semaphore);
+  assert(s.slow_paths >= 1 && s.wakeups >= 1);
+  assert(s.notifies == 1);
+
+  assert(!sem.try_acquire_for(cuda::std::chrono::milliseconds(10)));
+  s = cuda::wait_stats_snapshot(cuda::wait_site::semaphore);
+  assert(s.slow_paths >= 2);
+  check_zero(cuda::wait_site::atomic);
+}
+
+void test_object()
+{
+  cuda::wait_stats_reset();
+
+  cuda::std::atomic<int> a(0);
+  assert(cuda::wait_stats_snapshot(&a).notifies == 0);
+
+  auto waiter = [&](){
+    a.wait(0);
+  };
+  auto notifier = [&](){
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    a.store(1);
+    a.notify_one();
+  };
+  concurrent_agents_launch(waiter, notifier);
+
+  // The counters of the object's contention slot include its own wait and
+  // notify, and every row is zeroed by wait_stats_reset.
+  cuda::wait_stats const s = cuda::wait_stats_snapshot(&a);
+  assert(s.slow_paths >= 1 && s.wakeups >= 1);
+  assert(s.notifies >= 1);
+
+  cuda::wait_stats_reset();
+  assert(cuda::wait_stats_snapshot(&a).notifies == 0);
+  assert(cuda::wait_stats_snapshot(&a).wakeups == 0);
+}
+
+int main(int, char**)
+{
+    NV_IF_TARGET(NV_IS_HOST,(
+      cuda_thread_count = 2;
+
+      test_atomic();
+      test_barrier();
+      test_latch();
+      test_semaphore();
+      test_object();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: c++98, c++03
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/atomic>
+
+#include <cuda/atomic>
+#include <cuda/std/atomic>
+#include <cuda/std/chrono>
+#include <cuda/std/type_traits>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+#if !defined(TEST_COMPILER_C1XX)
+  #include "placement_new.h"
+#endif
+#include "../atomics.types.operations.req/atomic_helpers.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template <class A, class T>
+__host__ __device__
+void test()
+{
+    SHARED A * t;
+    execute_on_main_thread([&]{
+      t = (A *)malloc(sizeof(A));
+      new ((void *)t) A(T(1));
+      assert(t->try_wait_for(T(0), cuda::std::chrono::milliseconds(1)));
+      assert(!t->try_wait_for(T(1), cuda::std::chrono::milliseconds(1)));
+      assert(!t->try_wait_for(T(1), cuda::std::chrono::milliseconds(0)));
+      assert(!t->try_wait_until(T(1), cuda::std::chrono::high_resolution_clock::now() + cuda::std::chrono::milliseconds(1)));
+    });
+
+    auto agent_notify = LAMBDA (){
+      t->store(T(3));
+      t->notify_one();
+    };
+
+    auto agent_wait = LAMBDA (){
+      while(!t->try_wait_for(T(1), cuda::std::chrono::milliseconds(1))) {}
+      assert(t->try_wait_until(T(1), cuda::std::chrono::high_resolution_clock::now() + cuda::std::chrono::seconds(2)));
+    };
+
+    concurrent_agents_launch(agent_notify, agent_wait);
+}
+
+template <class T, template<typename, typename> typename Selector, cuda::thread_scope Scope>
+struct TestFn {
+  __host__ __device__
+  void operator()() const {
+    test<cuda::std::atomic<T>, T>();
+    test<cuda::atomic<T, Scope>, T>();
+    test<volatile cuda::std::atomic<T>, T>();
+  }
+};
+
+int main(int, char**)
+{
+    NV_IF_TARGET(NV_IS_HOST,
+        cuda_thread_count = 2;
+    )
+
+    TestEachAtomicType<TestFn, shared_memory_selector>()();
+
+  return 0;
+}
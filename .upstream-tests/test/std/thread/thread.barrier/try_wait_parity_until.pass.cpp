@@ -56,19 +56,29 @@ void test(bool add_delay = false)
   });
 }
 
+template<template<typename, typename> typename Selector>
+__host__ __device__
+void test_barriers(bool add_delay)
+{
+  test<cuda::barrier<cuda::thread_scope_block>, Selector>(add_delay);
+  test<cuda::std::barrier<>, Selector>(add_delay);
+  test<cuda::barrier<cuda::thread_scope_device>, Selector>(add_delay);
+  test<cuda::barrier<cuda::thread_scope_system>, Selector>(add_delay);
+}
+
 int main(int, char**)
 {
     NV_IF_ELSE_TARGET(NV_IS_HOST,(
         //Required by concurrent_agents_launch to know how many we're launching
         cuda_thread_count = 2;
 
-        test<cuda::barrier<cuda::thread_scope_block>, local_memory_selector>();
-        test<cuda::barrier<cuda::thread_scope_block>, local_memory_selector>(true);
+        test_barriers<local_memory_selector>(false);
+        test_barriers<local_memory_selector>(true);
     ),(
-        test<cuda::barrier<cuda::thread_scope_block>, shared_memory_selector>();
-        test<cuda::barrier<cuda::thread_scope_block>, global_memory_selector>();
-        test<cuda::barrier<cuda::thread_scope_block>, shared_memory_selector>(true);
-        test<cuda::barrier<cuda::thread_scope_block>, global_memory_selector>(true);
+        test_barriers<shared_memory_selector>(false);
+        test_barriers<global_memory_selector>(false);
+        test_barriers<shared_memory_selector>(true);
+        test_barriers<global_memory_selector>(true);
     ))
 
     return 0;
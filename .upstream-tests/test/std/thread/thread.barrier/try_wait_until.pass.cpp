@@ -18,6 +18,11 @@
 
 #include "cuda_space_selector.h"
 
+struct completion {
+  __host__ __device__
+  void operator()() noexcept {}
+};
+
 template<typename Barrier,
     template<typename, typename> typename Selector,
     typename Initializer = constructor_initializer>
@@ -35,6 +40,9 @@ void test(bool add_delay = false)
   typename Barrier::arrival_token* tok = nullptr;
   execute_on_main_thread([&]{
     tok = new auto(b->arrive());
+    // Only one of the two participants has arrived, so the wait times out.
+    assert(!b->try_wait_until(typename Barrier::arrival_token(*tok),
+                            cuda::std::chrono::system_clock::now() + cuda::std::chrono::milliseconds(1)));
   });
 
   auto awaiter = LAMBDA (){
@@ -55,19 +63,31 @@ void test(bool add_delay = false)
 
 
 
+template<template<typename, typename> typename Selector>
+__host__ __device__
+void test_barriers(bool add_delay)
+{
+  test<cuda::barrier<cuda::thread_scope_block>, Selector>(add_delay);
+  test<cuda::std::barrier<>, Selector>(add_delay);
+  test<cuda::barrier<cuda::thread_scope_device>, Selector>(add_delay);
+  test<cuda::barrier<cuda::thread_scope_system>, Selector>(add_delay);
+  test<cuda::barrier<cuda::thread_scope_system, completion>, Selector>(add_delay);
+  test<cuda::barrier<cuda::thread_scope_device, cuda::std::__empty_completion, cuda::barrier_tree<>>, Selector>(add_delay);
+}
+
 int main(int, char**)
 {
     NV_IF_ELSE_TARGET(NV_IS_HOST,(
         //Required by concurrent_agents_launch to know how many we're launching
         cuda_thread_count = 2;
 
-        test<cuda::barrier<cuda::thread_scope_block>, local_memory_selector>();
-        test<cuda::barrier<cuda::thread_scope_block>, local_memory_selector>(true);
+        test_barriers<local_memory_selector>(false);
+        test_barriers<local_memory_selector>(true);
     ),(
-        test<cuda::barrier<cuda::thread_scope_block>, shared_memory_selector>();
-        test<cuda::barrier<cuda::thread_scope_block>, global_memory_selector>();
-        test<cuda::barrier<cuda::thread_scope_block>, shared_memory_selector>(true);
-        test<cuda::barrier<cuda::thread_scope_block>, global_memory_selector>(true);
+        test_barriers<shared_memory_selector>(false);
+        test_barriers<global_memory_selector>(false);
+        test_barriers<shared_memory_selector>(true);
+        test_barriers<global_memory_selector>(true);
     ))
 
     return 0;
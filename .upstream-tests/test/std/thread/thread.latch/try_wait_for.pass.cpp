@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/latch>
+
+#include <cuda/std/latch>
+#include <cuda/std/chrono>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Latch,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  Selector<Latch, Initializer> sel;
+  SHARED Latch * l;
+  l = sel.construct(2);
+
+  execute_on_main_thread([&]{
+    l->count_down();
+    assert(!l->try_wait_for(cuda::std::chrono::milliseconds(1)));
+  });
+
+  auto awaiter = LAMBDA (){
+    assert(l->try_wait_for(cuda::std::chrono::seconds(10)));
+  };
+  auto counter = LAMBDA (){
+    l->count_down();
+  };
+  concurrent_agents_launch(awaiter, counter);
+
+  execute_on_main_thread([&]{
+    assert(l->try_wait_for(cuda::std::chrono::milliseconds(1)));
+  });
+}
+
+template<template<typename, typename> typename Selector>
+__host__ __device__
+void test_latches()
+{
+  test<cuda::std::latch, Selector>();
+  test<cuda::latch<cuda::thread_scope_block>, Selector>();
+  test<cuda::latch<cuda::thread_scope_device>, Selector>();
+  test<cuda::latch<cuda::thread_scope_system>, Selector>();
+  test<cuda::latch<cuda::thread_scope_system, cuda::latch_hierarchical<>>, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+      //Required by concurrent_agents_launch to know how many we're launching
+      cuda_thread_count = 2;
+
+      test_latches<local_memory_selector>();
+    ),(
+      test_latches<shared_memory_selector>();
+      test_latches<global_memory_selector>();
+    ))
+
+    return 0;
+}
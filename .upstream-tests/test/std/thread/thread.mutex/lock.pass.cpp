@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/mutex>
+
+#include <cuda/std/mutex>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Mutex,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  static_assert(sizeof(Mutex) == 4, "");
+
+  struct guarded {
+    Mutex m;
+    int count;
+  };
+
+  Selector<guarded, Initializer> sel;
+  SHARED guarded * g;
+  g = sel.construct();
+
+  execute_on_main_thread([&]{
+    g->count = 0;
+    g->m.lock();
+    g->m.unlock();
+  });
+
+  auto incrementer = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      g->m.lock();
+      ++g->count;
+      g->m.unlock();
+    }
+  };
+  auto guarded_incrementer = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      cuda::std::lock_guard<Mutex> lk(g->m);
+      ++g->count;
+    }
+  };
+
+  concurrent_agents_launch(incrementer, guarded_incrementer);
+
+  execute_on_main_thread([&]{
+    assert(g->count == 2000);
+    g->m.lock();
+    cuda::std::lock_guard<Mutex> lk(g->m, cuda::std::adopt_lock);
+  });
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 2;
+
+        test<cuda::std::mutex, local_memory_selector>();
+        test<cuda::std::timed_mutex, local_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_block>, local_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_device>, local_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_system>, local_memory_selector>();
+    ),(
+        test<cuda::std::mutex, shared_memory_selector>();
+        test<cuda::std::timed_mutex, shared_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_block>, shared_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_device>, shared_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_system>, shared_memory_selector>();
+
+        test<cuda::std::mutex, global_memory_selector>();
+        test<cuda::std::timed_mutex, global_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_block>, global_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_device>, global_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_system>, global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/mutex>
+
+#include <cuda/std/mutex>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Mutex,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  Selector<Mutex, Initializer> sel;
+  SHARED Mutex * m;
+  m = sel.construct();
+
+  execute_on_main_thread([&]{
+    assert(m->try_lock());
+    assert(!m->try_lock());
+    m->unlock();
+    assert(m->try_lock());
+  });
+
+  auto unlocker = LAMBDA (){
+    m->unlock();
+  };
+  auto locker = LAMBDA (){
+    while (!m->try_lock()) {}
+  };
+
+  concurrent_agents_launch(locker, unlocker);
+
+  execute_on_main_thread([&]{
+    assert(!m->try_lock());
+    m->unlock();
+  });
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 2;
+
+        test<cuda::std::mutex, local_memory_selector>();
+        test<cuda::std::timed_mutex, local_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_block>, local_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_device>, local_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_system>, local_memory_selector>();
+    ),(
+        test<cuda::std::mutex, shared_memory_selector>();
+        test<cuda::std::timed_mutex, shared_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_block>, shared_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_device>, shared_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_system>, shared_memory_selector>();
+
+        test<cuda::std::mutex, global_memory_selector>();
+        test<cuda::std::timed_mutex, global_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_block>, global_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_device>, global_memory_selector>();
+        test<cuda::mutex<cuda::thread_scope_system>, global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/mutex>
+
+#include <cuda/std/mutex>
+#include <cuda/std/chrono>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Mutex,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  typedef cuda::std::unique_lock<Mutex> Lock;
+
+  struct guarded {
+    Mutex m;
+    int count;
+  };
+
+  Selector<guarded, Initializer> sel;
+  SHARED guarded * g;
+  g = sel.construct();
+
+  execute_on_main_thread([&]{
+    g->count = 0;
+
+    Lock a(g->m);
+    assert(a.owns_lock() && a.mutex() == &g->m);
+    Lock b(g->m, cuda::std::try_to_lock);
+    assert(!b && b.mutex() == &g->m);
+    assert(!b.try_lock_for(cuda::std::chrono::milliseconds(1)));
+
+    b = cuda::std::move(a);
+    assert(!a.owns_lock() && a.mutex() == nullptr);
+    assert(b.owns_lock());
+    swap(a, b);
+    assert(a.owns_lock() && !b.owns_lock() && b.mutex() == nullptr);
+    a.unlock();
+    assert(!a.owns_lock());
+
+    Lock c(g->m, cuda::std::defer_lock);
+    assert(!c.owns_lock());
+    c.lock();
+    assert(c.owns_lock());
+    assert(c.release() == &g->m);
+    assert(!c.owns_lock() && c.mutex() == nullptr);
+    Lock d(g->m, cuda::std::adopt_lock);
+    assert(d.owns_lock());
+  });
+
+  auto incrementer = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      Lock lk(g->m, cuda::std::defer_lock);
+      lk.lock();
+      ++g->count;
+    }
+  };
+  auto timed_incrementer = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      Lock lk(g->m, cuda::std::chrono::seconds(2));
+      assert(lk.owns_lock());
+      ++g->count;
+    }
+  };
+
+  concurrent_agents_launch(incrementer, timed_incrementer);
+
+  execute_on_main_thread([&]{
+    assert(g->count == 2000);
+    Lock lk(g->m, cuda::std::try_to_lock);
+    assert(lk.owns_lock());
+  });
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 2;
+
+        test<cuda::std::timed_mutex, local_memory_selector>();
+        test<cuda::timed_mutex<cuda::thread_scope_block>, local_memory_selector>();
+        test<cuda::timed_mutex<cuda::thread_scope_device>, local_memory_selector>();
+        test<cuda::timed_mutex<cuda::thread_scope_system>, local_memory_selector>();
+    ),(
+        test<cuda::std::timed_mutex, shared_memory_selector>();
+        test<cuda::timed_mutex<cuda::thread_scope_block>, shared_memory_selector>();
+        test<cuda::timed_mutex<cuda::thread_scope_device>, shared_memory_selector>();
+        test<cuda::timed_mutex<cuda::thread_scope_system>, shared_memory_selector>();
+
+        test<cuda::std::timed_mutex, global_memory_selector>();
+        test<cuda::timed_mutex<cuda::thread_scope_block>, global_memory_selector>();
+        test<cuda::timed_mutex<cuda::thread_scope_device>, global_memory_selector>();
+        test<cuda::timed_mutex<cuda::thread_scope_system>, global_memory_selector>();
+    ))
+
+    return 0;
+}
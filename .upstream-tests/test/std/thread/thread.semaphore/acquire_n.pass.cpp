@@ -0,0 +1,107 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/semaphore>
+
+// acquire(n), try_acquire(n), try_acquire_for(n, d), try_acquire_until(n, t)
+
+#include <cuda/std/semaphore>
+#include <cuda/std/chrono>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Semaphore,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  Selector<Semaphore, Initializer> sel;
+  SHARED Semaphore * s;
+  s = sel.construct(5);
+
+  execute_on_main_thread([&]{
+    assert(!s->try_acquire(6));
+    assert(s->try_acquire(3));
+    assert(!s->try_acquire(3));
+    assert(!s->try_acquire_for(3, cuda::std::chrono::milliseconds(1)));
+    assert(!s->try_acquire_until(3, cuda::std::chrono::high_resolution_clock::now() + cuda::std::chrono::milliseconds(1)));
+    assert(s->try_acquire_for(2, cuda::std::chrono::milliseconds(0)));
+    assert(!s->try_acquire());
+  });
+
+  // Bulk acquires take all of their units at once, so the two takers
+  // cannot end up each holding part of what the other needs.
+  auto taker = LAMBDA (){
+    for (int i = 0; i < 100; ++i) {
+      s->acquire(3);
+      s->release(3);
+    }
+    assert(s->try_acquire_for(2, cuda::std::chrono::seconds(2)));
+    s->release(2);
+  };
+  auto releaser = LAMBDA (){
+    s->release(4);
+    for (int i = 0; i < 100; ++i) {
+      s->acquire();
+      s->release();
+    }
+  };
+  concurrent_agents_launch(taker, releaser);
+
+  execute_on_main_thread([&]{
+    s->acquire(4);
+    assert(!s->try_acquire());
+  });
+
+  // A blocked bulk acquire is woken by the release that covers it, and does
+  // not hold on to the wake-ups of single-unit acquires it cannot use.
+  auto bulk = LAMBDA (){
+    s->acquire(2);
+  };
+  auto single = LAMBDA (){
+    s->release(1);
+    s->acquire();
+    s->release(2);
+  };
+  concurrent_agents_launch(bulk, single);
+
+  execute_on_main_thread([&]{
+    assert(!s->try_acquire());
+  });
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 2;
+
+        test<cuda::std::counting_semaphore<>, local_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_block>, local_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_device>, local_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_system>, local_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_system, cuda::std::numeric_limits<ptrdiff_t>::max()>, local_memory_selector>();
+    ),(
+        test<cuda::std::counting_semaphore<>, shared_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_block>, shared_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_device>, shared_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_system>, shared_memory_selector>();
+
+        test<cuda::std::counting_semaphore<>, global_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_block>, global_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_device>, global_memory_selector>();
+        test<cuda::counting_semaphore<cuda::thread_scope_system>, global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/shared_mutex>
+
+#include <cuda/std/shared_mutex>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Mutex,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  struct guarded {
+    Mutex m;
+    int a;
+    int b;
+  };
+
+  Selector<guarded, Initializer> sel;
+  SHARED guarded * g;
+  g = sel.construct();
+
+  execute_on_main_thread([&]{
+    g->a = 0;
+    g->b = 0;
+  });
+
+  // Writers keep a and b equal; readers must never see them apart.
+  auto writer = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      cuda::std::lock_guard<Mutex> lk(g->m);
+      ++g->a;
+      ++g->b;
+    }
+  };
+  auto reader = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      g->m.lock_shared();
+      assert(g->a == g->b);
+      g->m.unlock_shared();
+    }
+  };
+
+  concurrent_agents_launch(writer, reader, reader);
+
+  execute_on_main_thread([&]{
+    g->m.lock();
+    assert(g->a == 1000 && g->b == 1000);
+    g->m.unlock();
+  });
+}
+
+template<template<typename, typename> typename Selector>
+__host__ __device__
+void test_mutexes()
+{
+  test<cuda::std::shared_mutex, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_block>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_device>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_system>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_device, cuda::shared_mutex_distributed<1>>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_device, cuda::shared_mutex_compact>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_system, cuda::shared_mutex_compact>, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 3;
+
+        test_mutexes<local_memory_selector>();
+    ),(
+        test_mutexes<shared_memory_selector>();
+        test_mutexes<global_memory_selector>();
+    ))
+
+    return 0;
+}
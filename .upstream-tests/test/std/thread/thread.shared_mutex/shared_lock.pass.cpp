@@ -0,0 +1,115 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/shared_mutex>
+
+#include <cuda/std/shared_mutex>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Mutex,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  typedef cuda::std::shared_lock<Mutex> Lock;
+
+  struct guarded {
+    Mutex m;
+    int count;
+  };
+
+  Selector<guarded, Initializer> sel;
+  SHARED guarded * g;
+  g = sel.construct();
+
+  execute_on_main_thread([&]{
+    g->count = 0;
+
+    Lock a(g->m);
+    assert(a.owns_lock() && a.mutex() == &g->m);
+    Lock b(g->m, cuda::std::try_to_lock);
+    assert(b.owns_lock());
+    assert(!g->m.try_lock());
+    b.unlock();
+    assert(!b);
+
+    b = cuda::std::move(a);
+    assert(!a.owns_lock() && a.mutex() == nullptr);
+    assert(b.owns_lock());
+    swap(a, b);
+    assert(a.owns_lock() && !b.owns_lock() && b.mutex() == nullptr);
+    a.unlock();
+    assert(!a.owns_lock());
+
+    Lock c(g->m, cuda::std::defer_lock);
+    assert(!c.owns_lock());
+    c.lock();
+    assert(c.owns_lock());
+    assert(c.release() == &g->m);
+    assert(!c.owns_lock() && c.mutex() == nullptr);
+    Lock d(g->m, cuda::std::adopt_lock);
+    assert(d.owns_lock());
+  });
+
+  auto writer = LAMBDA (){
+    for (int i = 0; i < 1000; ++i) {
+      cuda::std::unique_lock<Mutex> lk(g->m);
+      ++g->count;
+    }
+  };
+  auto reader = LAMBDA (){
+    int last = 0;
+    while (last != 1000) {
+      Lock lk(g->m);
+      assert(g->count >= last);
+      last = g->count;
+    }
+  };
+
+  concurrent_agents_launch(writer, reader);
+
+  execute_on_main_thread([&]{
+    assert(g->count == 1000);
+    assert(g->m.try_lock());
+    g->m.unlock();
+  });
+}
+
+template<template<typename, typename> typename Selector>
+__host__ __device__
+void test_mutexes()
+{
+  test<cuda::std::shared_mutex, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_block>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_device>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_system>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_device, cuda::shared_mutex_distributed<1>>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_device, cuda::shared_mutex_compact>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_system, cuda::shared_mutex_compact>, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 2;
+
+        test_mutexes<local_memory_selector>();
+    ),(
+        test_mutexes<shared_memory_selector>();
+        test_mutexes<global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/std/shared_mutex>
+
+#include <cuda/std/shared_mutex>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+template<typename Mutex,
+    template<typename, typename> typename Selector,
+    typename Initializer = constructor_initializer>
+__host__ __device__
+void test()
+{
+  Selector<Mutex, Initializer> sel;
+  SHARED Mutex * m;
+  m = sel.construct();
+
+  execute_on_main_thread([&]{
+    assert(m->try_lock_shared());
+    assert(m->try_lock_shared());
+    assert(!m->try_lock());
+    m->unlock_shared();
+    assert(!m->try_lock());
+    m->unlock_shared();
+    assert(m->try_lock());
+    assert(!m->try_lock());
+    assert(!m->try_lock_shared());
+    m->unlock();
+  });
+
+  // A shared or exclusive try_lock eventually succeeds under contention from the other kind.
+  auto writer = LAMBDA (){
+    for (int i = 0; i < 100; ++i) {
+      while (!m->try_lock()) {}
+      m->unlock();
+    }
+  };
+  auto reader = LAMBDA (){
+    for (int i = 0; i < 100; ++i) {
+      while (!m->try_lock_shared()) {}
+      m->unlock_shared();
+    }
+  };
+
+  concurrent_agents_launch(writer, reader);
+
+  execute_on_main_thread([&]{
+    assert(m->try_lock());
+    assert(!m->try_lock_shared());
+    m->unlock();
+    assert(m->try_lock_shared());
+    m->unlock_shared();
+  });
+}
+
+template<template<typename, typename> typename Selector>
+__host__ __device__
+void test_mutexes()
+{
+  test<cuda::std::shared_mutex, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_block>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_device>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_system>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_device, cuda::shared_mutex_distributed<1>>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_device, cuda::shared_mutex_compact>, Selector>();
+  test<cuda::shared_mutex<cuda::thread_scope_system, cuda::shared_mutex_compact>, Selector>();
+}
+
+int main(int, char**)
+{
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        cuda_thread_count = 2;
+
+        test_mutexes<local_memory_selector>();
+    ),(
+        test_mutexes<shared_memory_selector>();
+        test_mutexes<global_memory_selector>();
+    ))
+
+    return 0;
+}
@@ -28,6 +28,7 @@ THE SOFTWARE.
 
 #include <cmath>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
 #include <vector>
 #include <string>
@@ -49,6 +50,8 @@ THE SOFTWARE.
 #include <cuda/std/atomic>
 #include <cuda/std/barrier>
 #include <cuda/std/latch>
+#include <cuda/std/mutex>
+#include <cuda/std/shared_mutex>
 #include <cuda/std/semaphore>
 
 #ifdef __CUDACC__
@@ -182,6 +185,56 @@ struct sem_mutex {
     cuda::binary_semaphore<cuda::thread_scope_device> c;
 };
 
+struct fifo_sem_mutex {
+    _ABI void lock() noexcept {
+        c.acquire();
+    }
+    _ABI void unlock() noexcept {
+        c.release();
+    }
+    fifo_sem_mutex() : c(1) { }
+    cuda::counting_semaphore<cuda::thread_scope_device, 1, cuda::semaphore_fifo<>> c;
+};
+
+template <cuda::thread_scope Scope>
+struct atomic_counter {
+    _ABI void add(cuda::std::uint64_t v) noexcept {
+        c.fetch_add(v, cuda::std::memory_order_relaxed);
+    }
+    _ABI cuda::std::uint64_t load() const noexcept {
+        return c.load(cuda::std::memory_order_relaxed);
+    }
+    alignas(64) cuda::atomic<cuda::std::uint64_t, Scope> c = ATOMIC_VAR_INIT(0);
+};
+
+// fetch_max as a compare-and-swap loop that always writes, for comparison with
+// cuda::atomic::fetch_max, which returns early when the object already dominates.
+template <cuda::thread_scope Scope>
+struct cas_max {
+    _ABI void update(cuda::std::uint64_t v) noexcept {
+        auto e = c.load(cuda::std::memory_order_relaxed);
+        while(!c.compare_exchange_strong(e, e > v ? e : v, cuda::std::memory_order_relaxed))
+            ;
+    }
+    alignas(64) cuda::atomic<cuda::std::uint64_t, Scope> c = ATOMIC_VAR_INIT(0);
+};
+
+template <cuda::thread_scope Scope>
+struct fetch_max {
+    _ABI void update(cuda::std::uint64_t v) noexcept {
+        c.fetch_max(v, cuda::std::memory_order_relaxed);
+    }
+    alignas(64) cuda::atomic<cuda::std::uint64_t, Scope> c = ATOMIC_VAR_INIT(0);
+};
+
+template <cuda::thread_scope Scope>
+struct float_sum {
+    _ABI void update(cuda::std::uint64_t) noexcept {
+        c.fetch_add(1.0f, cuda::std::memory_order_relaxed);
+    }
+    alignas(64) cuda::atomic<float, Scope> c = ATOMIC_VAR_INIT(0.0f);
+};
+
 static constexpr int sections = 1 << 18;
 
 using sum_mean_dev_t = std::tuple<double, double, double>;
@@ -329,21 +382,49 @@ void test_loop(cuda::thread_scope scope, F && f) {
     }
 }
 
+// Each thread keeps its most recent lock() latencies in a ring of this many samples.
+int const latency_samples = 1024;
+
+void print_latency(cuda::std::int64_t const* samples, int count) {
+    std::vector<cuda::std::int64_t> v;
+    for (int i = 0; i < count; ++i)
+        if (samples[i] >= 0)
+            v.push_back(samples[i]);
+    if (v.empty())
+        return;
+    auto const percentile = [&](int p) {
+        auto const it = v.begin() + (v.size() - 1) * p / 100;
+        std::nth_element(v.begin(), it, v.end());
+        return *it;
+    };
+    auto const p50 = percentile(50);
+    auto const p99 = percentile(99);
+    std::cout << "    lock latency p50 = " << p50 << "ns, p99 = " << p99 << "ns." << std::endl;
+}
+
 template<class M>
 void test_mutex_contended(std::string const& name, bool use_omp = false) {
     test_loop(cuda::thread_scope_system, [&](std::pair<int, std::string> c) {
         M* m = make_<M>();
         cuda::std::atomic<bool> *keep_going = make_<cuda::std::atomic<bool>>(true);
-        auto f = [=] _ABI (int, int) -> int {
+        std::vector<cuda::std::int64_t, managed_allocator<cuda::std::int64_t>> latency(c.first * latency_samples, -1);
+        cuda::std::int64_t* latency_ = &latency[0];
+        auto f = [=] _ABI (int, int id) -> int {
+            using clock = cuda::std::chrono::high_resolution_clock;
             int i = 0;
             while(keep_going->load(cuda::std::memory_order_relaxed)) {
+                auto const t1 = clock::now();
                 m->lock();
+                auto const t2 = clock::now();
+                latency_[id * latency_samples + i % latency_samples] =
+                    cuda::std::chrono::duration_cast<cuda::std::chrono::nanoseconds>(t2 - t1).count();
                 ++i;
                 m->unlock();
             }
             return i;
         };
         test(name + ", " + c.second, c.first, f, *keep_going, use_omp, false, cuda::thread_scope_system);
+        print_latency(latency_, c.first * latency_samples);
         unmake_(m);
         unmake_(keep_going);
     });
@@ -375,6 +456,79 @@ void test_mutex(std::string const& name, bool use_omp = false) {
     test_mutex_contended<M>(name + " contended", use_omp);
 }
 
+// Every write_every-th step of each thread takes the lock exclusively; the rest take it shared.
+template<class M>
+void test_shared_mutex_mix(std::string const& name, int write_every, bool use_omp) {
+    test_loop(cuda::thread_scope_system, [&](std::pair<int, std::string> c) {
+        M* m = make_<M>();
+        cuda::std::atomic<bool> *keep_going = make_<cuda::std::atomic<bool>>(true);
+        auto f = [=] _ABI (int, int) -> int {
+            int i = 0;
+            while(keep_going->load(cuda::std::memory_order_relaxed)) {
+                if(write_every != 0 && i % write_every == 0) {
+                    m->lock();
+                    m->unlock();
+                }
+                else {
+                    m->lock_shared();
+                    m->unlock_shared();
+                }
+                ++i;
+            }
+            return i;
+        };
+        test(name + ": " + c.second, c.first, f, *keep_going, use_omp, true, cuda::thread_scope_system);
+        unmake_(m);
+        unmake_(keep_going);
+    });
+};
+
+template<class M>
+void test_shared_mutex(std::string const& name, bool use_omp = false) {
+    test_shared_mutex_mix<M>(name + " reads", 0, use_omp);
+    test_shared_mutex_mix<M>(name + " 1% writes", 100, use_omp);
+}
+
+template<class C>
+void test_counter(std::string const& name, cuda::thread_scope scope) {
+    test_loop(scope, [&](std::pair<int, std::string> c) {
+        C* counter = make_<C>();
+        cuda::std::atomic<bool> *keep_going = make_<cuda::std::atomic<bool>>(true);
+        auto f = [=] _ABI (int, int) -> int {
+            int i = 0;
+            while(keep_going->load(cuda::std::memory_order_relaxed)) {
+                counter->add(1);
+                ++i;
+            }
+            return i;
+        };
+        test(name + ": " + c.second, c.first, f, *keep_going, false, true, scope);
+        unmake_(counter);
+        unmake_(keep_going);
+    });
+};
+
+// Every thread feeds its own increasing sequence, so threads that fall behind
+// mostly offer values that no longer change a max reduction.
+template<class R>
+void test_reduction(std::string const& name, cuda::thread_scope scope) {
+    test_loop(scope, [&](std::pair<int, std::string> c) {
+        R* r = make_<R>();
+        cuda::std::atomic<bool> *keep_going = make_<cuda::std::atomic<bool>>(true);
+        auto f = [=] _ABI (int, int) -> int {
+            int i = 0;
+            while(keep_going->load(cuda::std::memory_order_relaxed)) {
+                r->update(i);
+                ++i;
+            }
+            return i;
+        };
+        test(name + ": " + c.second, c.first, f, *keep_going, false, true, scope);
+        unmake_(r);
+        unmake_(keep_going);
+    });
+};
+
 template<typename Barrier>
 struct scope_of_barrier
 {
@@ -389,8 +543,8 @@ struct scope_of_barrier<nvcuda::experimental::awbarrier>
 };
 #endif
 
-template<cuda::thread_scope Scope, typename F>
-struct scope_of_barrier<cuda::barrier<Scope, F>>
+template<cuda::thread_scope Scope, typename F, typename Algorithm>
+struct scope_of_barrier<cuda::barrier<Scope, F, Algorithm>>
 {
     static const constexpr auto scope = Scope;
 };
@@ -454,8 +608,8 @@ struct scope_of_latch
     static const constexpr auto scope = cuda::thread_scope_system;
 };
 
-template<cuda::thread_scope Scope>
-struct scope_of_latch<cuda::latch<Scope>>
+template<cuda::thread_scope Scope, class Algorithm>
+struct scope_of_latch<cuda::latch<Scope, Algorithm>>
 {
     static const constexpr auto scope = Scope;
 };
@@ -499,6 +653,11 @@ int main() {
 
 #ifndef __NO_MUTEX
     test_mutex<sem_mutex>("sem_mutex");
+    test_mutex<fifo_sem_mutex>("fifo_sem_mutex");
+    test_mutex<cuda::std::mutex>("cuda::std::mutex");
+    test_mutex<cuda::mutex<cuda::thread_scope_device>>("cuda::mutex<device>");
+    test_mutex<cuda::mcs_lock<cuda::thread_scope_device>>("cuda::mcs_lock<device>");
+    test_mutex<cuda::clh_lock<cuda::thread_scope_device>>("cuda::clh_lock<device>");
 //  test_mutex<null_mutex>("Null");
     test_mutex<mutex>("spinlock_mutex");
     test_mutex<ticket_mutex>("ticket_mutex");
@@ -507,17 +666,55 @@ int main() {
 #endif
 #endif
 
+#ifndef __NO_SHARED_MUTEX
+    test_shared_mutex<cuda::shared_mutex<cuda::thread_scope_device>>("cuda::shared_mutex<device>");
+    test_shared_mutex<cuda::shared_mutex<cuda::thread_scope_device, cuda::shared_mutex_compact>>("cuda::shared_mutex<device, compact>");
+#if !defined(__CUDACC__) && defined(__cpp_lib_shared_mutex)
+    test_shared_mutex<std::shared_mutex>("std::shared_mutex");
+#endif
+#endif
+
+#ifndef __NO_COUNTER
+#ifdef __CUDACC__
+    test_counter<atomic_counter<cuda::thread_scope_device>>("cuda::atomic<uint64_t, device> counter", cuda::thread_scope_device);
+    test_counter<cuda::sharded_counter<cuda::std::uint64_t, cuda::thread_scope_device>>("cuda::sharded_counter<uint64_t, device>", cuda::thread_scope_device);
+#endif
+    test_counter<atomic_counter<cuda::thread_scope_system>>("cuda::atomic<uint64_t, system> counter", cuda::thread_scope_system);
+    test_counter<cuda::sharded_counter<cuda::std::uint64_t, cuda::thread_scope_system>>("cuda::sharded_counter<uint64_t, system>", cuda::thread_scope_system);
+#endif
+
+#ifndef __NO_REDUCTION
+#ifdef __CUDACC__
+    test_reduction<cas_max<cuda::thread_scope_device>>("compare_exchange max<uint64_t, device>", cuda::thread_scope_device);
+    test_reduction<fetch_max<cuda::thread_scope_device>>("cuda::atomic<uint64_t, device>::fetch_max", cuda::thread_scope_device);
+    test_reduction<float_sum<cuda::thread_scope_device>>("cuda::atomic<float, device>::fetch_add", cuda::thread_scope_device);
+#endif
+    test_reduction<cas_max<cuda::thread_scope_system>>("compare_exchange max<uint64_t, system>", cuda::thread_scope_system);
+    test_reduction<fetch_max<cuda::thread_scope_system>>("cuda::atomic<uint64_t, system>::fetch_max", cuda::thread_scope_system);
+    test_reduction<float_sum<cuda::thread_scope_system>>("cuda::atomic<float, system>::fetch_add", cuda::thread_scope_system);
+#endif
+
 #ifndef __NO_BARRIER
 #ifdef __CUDACC__
     test_latch<cuda::latch<cuda::thread_scope_block>>("cuda::latch<block>");
     test_latch<cuda::latch<cuda::thread_scope_device>>("cuda::latch<device>");
 #endif
     test_latch<cuda::latch<cuda::thread_scope_system>>("cuda::latch<system>");
+    test_latch<cuda::latch<cuda::thread_scope_system,
+                           cuda::latch_hierarchical<cuda::barrier_inline_storage<4096>>>>("cuda::latch<system, hierarchical>");
 #ifdef __CUDACC__
     test_barrier<cuda::barrier<cuda::thread_scope_block>>("cuda::barrier<block>");
     test_barrier<cuda::barrier<cuda::thread_scope_device>>("cuda::barrier<device>");
 #endif
     test_barrier<cuda::barrier<cuda::thread_scope_system>>("cuda::barrier<system>");
+    test_barrier<cuda::barrier<cuda::thread_scope_system, cuda::std::__empty_completion,
+                               cuda::barrier_tree<cuda::barrier_inline_storage<4096>>>>("cuda::barrier<system, tree>");
+    test_barrier<cuda::barrier<cuda::thread_scope_system, cuda::std::__empty_completion,
+                               cuda::barrier_dissemination<cuda::barrier_inline_storage<4096>>>>("cuda::barrier<system, dissemination>");
+    test_barrier<cuda::barrier<cuda::thread_scope_system, cuda::std::__empty_completion,
+                               cuda::barrier_tournament<cuda::barrier_inline_storage<4096>>>>("cuda::barrier<system, tournament>");
+    test_barrier<cuda::barrier<cuda::thread_scope_system, cuda::std::__empty_completion,
+                               cuda::barrier_hierarchical<cuda::barrier_inline_storage<4096>>>>("cuda::barrier<system, hierarchical>");
 #ifdef __CUDACC__
     test_barrier_shared<nvcuda::experimental::awbarrier>("nvcuda::exp::awbarrier __shared__");
 #endif
@@ -0,0 +1,168 @@
+/*
+
+Copyright (c) 2023, NVIDIA Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+// Host copy bandwidth of memcpy_async into barriers, against a plain memcpy.
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <cuda/barrier>
+#include <cuda/std/mdspan>
+#ifdef __CUDACC__
+// annotated_ptr needs the CUDA runtime headers.
+#  include <cuda/annotated_ptr>
+#endif
+
+constexpr std::size_t total_bytes = std::size_t(4) << 30;
+
+struct buffers {
+    char* src;
+    char* dst;
+    std::size_t size;
+
+    explicit buffers(std::size_t size_) : size(size_) {
+        src = static_cast<char*>(aligned_alloc(64, size));
+        dst = static_cast<char*>(aligned_alloc(64, size));
+        assert(src != nullptr && dst != nullptr);
+        memset(src, 1, size);
+        memset(dst, 0, size);
+    }
+    ~buffers() {
+        free(src);
+        free(dst);
+    }
+};
+
+// Runs copy(src, dst, size) until total_bytes have been copied, and reports GB/s.
+template <class Copy>
+void test_copy(std::string const& name, buffers& b, Copy copy) {
+    std::size_t const steps = total_bytes / b.size > 4 ? total_bytes / b.size : 4;
+
+    copy(b.dst, b.src, b.size);
+    auto const t1 = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < steps; ++i)
+        copy(b.dst, b.src, b.size);
+    auto const t2 = std::chrono::steady_clock::now();
+    assert(memcmp(b.dst, b.src, b.size) == 0);
+
+    double const ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+    std::cout << std::setprecision(2) << std::fixed;
+    std::cout << "  " << std::setw(40) << std::left << name << ": "
+              << double(steps * b.size) / ns << " GB/s" << std::endl;
+}
+
+void test_size(std::size_t size) {
+    std::cout << "============================" << std::endl;
+    std::cout << (size >> 20) << " MiB copies:" << std::endl;
+
+    buffers b(size);
+    cuda::barrier<cuda::thread_scope_system> bar(1);
+
+    test_copy("memcpy", b, [](char* dst, char const* src, std::size_t n) {
+        memcpy(dst, src, n);
+    });
+    test_copy("cuda::memcpy_async", b, [&](char* dst, char const* src, std::size_t n) {
+        cuda::memcpy_async(dst, src, n, bar);
+        bar.arrive_and_wait();
+    });
+    test_copy("cuda::memcpy_async, aligned_size_t<64>", b, [&](char* dst, char const* src, std::size_t n) {
+        cuda::memcpy_async(dst, src, cuda::aligned_size_t<64>(n), bar);
+        bar.arrive_and_wait();
+    });
+#ifdef __CUDACC__
+    test_copy("cuda::memcpy_async, streaming destination", b, [&](char* dst, char const* src, std::size_t n) {
+        cuda::memcpy_async(cuda::annotated_ptr<char, cuda::access_property::streaming>(dst),
+                           cuda::annotated_ptr<char const, cuda::access_property::normal>(src),
+                           cuda::aligned_size_t<64>(n), bar);
+        bar.arrive_and_wait();
+    });
+#endif
+}
+
+#ifdef _LIBCUDACXX_HAS_MEMCPY_ASYNC_MDSPAN
+// Gathers the centre quarter of an n by n row-major matrix.
+void test_tile(std::size_t n) {
+    std::cout << "============================" << std::endl;
+    std::cout << n / 2 << " x " << n / 2 << " tile of an int matrix:" << std::endl;
+
+    using extents2 = cuda::std::dextents<std::size_t, 2>;
+    std::size_t const tile = n / 2;
+    buffers b(n * n * sizeof(int));
+    int const* const src = reinterpret_cast<int const*>(b.src) + (n / 4) * n + n / 4;
+    int* const dst = reinterpret_cast<int*>(b.dst);
+    cuda::barrier<cuda::thread_scope_system> bar(1);
+
+    auto const time = [&](std::string const& name, auto copy) {
+        std::size_t const steps = total_bytes / (tile * tile * sizeof(int));
+        copy();
+        auto const t1 = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < steps; ++i)
+            copy();
+        auto const t2 = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < tile; ++i)
+            assert(memcmp(dst + i * tile, src + i * n, tile * sizeof(int)) == 0);
+
+        double const ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+        std::cout << std::setprecision(2) << std::fixed;
+        std::cout << "  " << std::setw(40) << std::left << name << ": "
+                  << double(steps * tile * tile * sizeof(int)) / ns << " GB/s" << std::endl;
+    };
+
+    time("cuda::memcpy_async per row", [&]() {
+        for (std::size_t i = 0; i < tile; ++i)
+            cuda::memcpy_async(dst + i * tile, src + i * n, tile * sizeof(int), bar);
+        bar.arrive_and_wait();
+    });
+    time("cuda::memcpy_async, mdspan", [&]() {
+        cuda::std::mdspan<int const, extents2, cuda::std::layout_stride> from(
+            src, cuda::std::layout_stride::mapping<extents2>(extents2(tile, tile), cuda::std::array<std::size_t, 2>{n, 1}));
+        cuda::memcpy_async(cuda::std::mdspan<int, extents2>(dst, tile, tile), from, bar);
+        bar.arrive_and_wait();
+    });
+}
+#endif
+
+int main() {
+
+    test_size(std::size_t(1) << 20);
+    test_size(std::size_t(16) << 20);
+    test_size(std::size_t(64) << 20);
+    test_size(std::size_t(256) << 20);
+
+#ifdef _LIBCUDACXX_HAS_MEMCPY_ASYNC_MDSPAN
+    test_tile(512);
+    test_tile(4096);
+#endif
+
+    return 0;
+}
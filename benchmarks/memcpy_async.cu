@@ -0,0 +1 @@
+#include "memcpy_async.cpp"
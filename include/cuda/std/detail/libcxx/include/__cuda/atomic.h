@@ -42,6 +42,94 @@ constexpr memory_order memory_order_release = std::memory_order_release;
 constexpr memory_order memory_order_acq_rel = std::memory_order_acq_rel;
 constexpr memory_order memory_order_seq_cst = std::memory_order_seq_cst;
 
+#ifndef _LIBCUDACXX_HAS_NO_THREADS
+// Backoff policies, accepted by the waiting operations of atomic, atomic_ref, barrier, latch
+// and the semaphores.
+using default_backoff = std::__libcpp_backoff_default;
+using yield_backoff = std::__libcpp_backoff_yield;
+template <int _MaxShift = 10>
+using exponential_backoff = std::__libcpp_backoff_exponential<_MaxShift>;
+template <long long _SpinNs>
+using calibrated_backoff = std::__libcpp_backoff_calibrated<_SpinNs>;
+template <long long _MaxSleepNs>
+using sleep_capped_backoff = std::__libcpp_backoff_sleep_capped<_MaxSleepNs>;
+
+// Wait-path statistics, collected by host threads when _LIBCUDACXX_ENABLE_WAIT_STATS is
+// defined before any libcu++ header. Without it the counters are never touched and read as zero.
+enum class wait_site : int {
+    atomic = std::__libcpp_wait_site_atomic,
+    barrier = std::__libcpp_wait_site_barrier,
+    latch = std::__libcpp_wait_site_latch,
+    semaphore = std::__libcpp_wait_site_semaphore,
+    mutex = std::__libcpp_wait_site_mutex
+};
+
+struct wait_stats {
+    long long spins;             // polls made before blocking or sleeping
+    long long slow_paths;        // times a waiter blocked or started sleeping
+    long long sleep_ns;          // time spent blocked or sleeping
+    long long wakeups;           // returns from blocking that found the value changed
+    long long spurious_wakeups;  // returns from blocking that found it unchanged
+    long long notifies;          // notify_one/notify_all calls
+    long long idle_notifies;     // notifies that found no waiter registered
+};
+
+#if !defined(_LIBCUDACXX_COMPILER_NVRTC)
+inline wait_stats __wait_stats_read(long long* __row, bool __reset) noexcept {
+    long long __counts[std::__libcpp_wait_event_count] = {};
+#if defined(_LIBCUDACXX_ENABLE_WAIT_STATS)
+    for (int __e = 0; __e < std::__libcpp_wait_event_count; ++__e)
+        __counts[__e] = __reset ? std::__libcpp_wait_stats_host_exchange(__row + __e, 0)
+                                : std::__libcpp_wait_stats_host_add(__row + __e, 0);
+#else
+    (void)__row;
+    (void)__reset;
+#endif // _LIBCUDACXX_ENABLE_WAIT_STATS
+    return wait_stats{__counts[std::__libcpp_wait_event_spin],
+                      __counts[std::__libcpp_wait_event_slow_path],
+                      __counts[std::__libcpp_wait_event_sleep_ns],
+                      __counts[std::__libcpp_wait_event_wakeup],
+                      __counts[std::__libcpp_wait_event_spurious_wakeup],
+                      __counts[std::__libcpp_wait_event_notify],
+                      __counts[std::__libcpp_wait_event_idle_notify]};
+}
+
+#if defined(_LIBCUDACXX_ENABLE_WAIT_STATS)
+inline long long* __wait_stats_row(wait_site __site) noexcept {
+    return std::__libcpp_wait_stats_table<>::__counts[static_cast<int>(__site)];
+}
+inline long long* __wait_stats_row(void const volatile* __object) noexcept {
+    return std::__libcpp_wait_stats_table<>::__slot_counts[std::__libcpp_contention_hash(__object) % _LIBCUDACXX_CONTENTION_TABLE_SIZE];
+}
+#else
+inline long long* __wait_stats_row(wait_site) noexcept { return nullptr; }
+inline long long* __wait_stats_row(void const volatile*) noexcept { return nullptr; }
+#endif // _LIBCUDACXX_ENABLE_WAIT_STATS
+
+// Returns the counters of one kind of call site. Each counter is read atomically, but the
+// snapshot as a whole is not consistent with waits running concurrently.
+inline wait_stats wait_stats_snapshot(wait_site __site) noexcept {
+    return __wait_stats_read(__wait_stats_row(__site), false);
+}
+
+// Returns the counters of the contention slot that the atomic object at __object hashes to,
+// which it shares with every other object hashing there.
+inline wait_stats wait_stats_snapshot(void const volatile* __object) noexcept {
+    return __wait_stats_read(__wait_stats_row(__object), false);
+}
+
+// Zeroes the counters of every kind of call site and every contention slot.
+inline void wait_stats_reset() noexcept {
+#if defined(_LIBCUDACXX_ENABLE_WAIT_STATS)
+    for (int __s = 0; __s < std::__libcpp_wait_site_count; ++__s)
+        (void)__wait_stats_read(std::__libcpp_wait_stats_table<>::__counts[__s], true);
+    for (int __s = 0; __s < _LIBCUDACXX_CONTENTION_TABLE_SIZE; ++__s)
+        (void)__wait_stats_read(std::__libcpp_wait_stats_table<>::__slot_counts[__s], true);
+#endif // _LIBCUDACXX_ENABLE_WAIT_STATS
+}
+#endif // _LIBCUDACXX_COMPILER_NVRTC
+#endif // _LIBCUDACXX_HAS_NO_THREADS
+
 // atomic<T>
 
 template <class _Tp, thread_scope _Sco = thread_scope::thread_scope_system>
@@ -255,6 +343,245 @@ inline _LIBCUDACXX_HOST_DEVICE void atomic_signal_fence(memory_order __m) {
     std::atomic_signal_fence(__m);
 }
 
+// atomic_snapshot<T>
+
+// A seqlock for large values that are read far more often than written.
+// Writers serialize on an odd sequence number while they copy a value in;
+// readers take no lock and only retry a copy that overlapped a write.
+// Loads have acquire semantics and stores release semantics.
+template <class _Tp, thread_scope _Sco = thread_scope::thread_scope_system>
+class atomic_snapshot
+{
+    static_assert(std::is_trivially_copyable<_Tp>::value,
+        "cuda::atomic_snapshot<T> requires that 'T' be a trivially copyable type");
+
+    using __word_t = std::__conditional_t<sizeof(_Tp) % sizeof(std::uint64_t) == 0,
+                                          std::uint64_t, std::uint32_t>;
+    static constexpr size_t __word_count = (sizeof(_Tp) + sizeof(__word_t) - 1) / sizeof(__word_t);
+
+    atomic<std::uint32_t, _Sco> __seq;
+    mutable __word_t __words[__word_count];
+
+    _LIBCUDACXX_HOST_DEVICE
+    void __read_words(__word_t* __buf) const noexcept {
+        for (size_t __i = 0; __i < __word_count; ++__i)
+            __buf[__i] = atomic_ref<__word_t, _Sco>(__words[__i]).load(memory_order_relaxed);
+    }
+    _LIBCUDACXX_HOST_DEVICE
+    void __write_words(__word_t const* __buf) noexcept {
+        for (size_t __i = 0; __i < __word_count; ++__i)
+            atomic_ref<__word_t, _Sco>(__words[__i]).store(__buf[__i], memory_order_relaxed);
+    }
+
+    _LIBCUDACXX_HOST_DEVICE
+    std::uint32_t __lock() noexcept {
+        std::uint32_t __s = __seq.load(memory_order_relaxed);
+        for (;;) {
+            if (__s & 1) {
+                __seq.wait(__s, memory_order_relaxed);
+                __s = __seq.load(memory_order_relaxed);
+            }
+            else if (__seq.compare_exchange_weak(__s, __s + 1, memory_order_acquire, memory_order_relaxed)) {
+                break;
+            }
+        }
+        // Keep the stores to the words from becoming visible before the odd sequence number.
+        atomic_thread_fence(memory_order_release, _Sco);
+        return __s + 1;
+    }
+    _LIBCUDACXX_HOST_DEVICE
+    void __unlock(std::uint32_t __s) noexcept {
+        __seq.store(__s + 1, memory_order_release);
+        __seq.notify_all();
+    }
+
+public:
+    using value_type = _Tp;
+
+    _LIBCUDACXX_HOST_DEVICE
+    atomic_snapshot() noexcept : __seq(0), __words() {}
+    _LIBCUDACXX_HOST_DEVICE
+    explicit atomic_snapshot(_Tp const& __v) noexcept : __seq(0), __words() {
+        memcpy(__words, &__v, sizeof(_Tp));
+    }
+
+    atomic_snapshot(const atomic_snapshot&) = delete;
+    atomic_snapshot& operator=(const atomic_snapshot&) = delete;
+
+    _LIBCUDACXX_HOST_DEVICE
+    _Tp load() const noexcept {
+        __word_t __buf[__word_count];
+        std::uint32_t __s = __seq.load(memory_order_acquire);
+        for (;;) {
+            if (__s & 1) {
+                __seq.wait(__s, memory_order_acquire);
+                __s = __seq.load(memory_order_acquire);
+                continue;
+            }
+            __read_words(__buf);
+            atomic_thread_fence(memory_order_acquire, _Sco);
+            std::uint32_t const __t = __seq.load(memory_order_relaxed);
+            if (__t == __s)
+                break;
+            __s = __t;
+        }
+        _Tp __ret;
+        memcpy(&__ret, __buf, sizeof(_Tp));
+        return __ret;
+    }
+    _LIBCUDACXX_HOST_DEVICE
+    operator _Tp() const noexcept {return load();}
+
+    _LIBCUDACXX_HOST_DEVICE
+    void store(_Tp const& __v) noexcept {
+        __word_t __buf[__word_count] = {};
+        memcpy(__buf, &__v, sizeof(_Tp));
+        std::uint32_t const __s = __lock();
+        __write_words(__buf);
+        __unlock(__s);
+    }
+    _LIBCUDACXX_HOST_DEVICE
+    _Tp operator=(_Tp const& __v) noexcept {store(__v); return __v;}
+
+    _LIBCUDACXX_HOST_DEVICE
+    _Tp exchange(_Tp const& __v) noexcept {
+        __word_t __old[__word_count];
+        __word_t __buf[__word_count] = {};
+        memcpy(__buf, &__v, sizeof(_Tp));
+        std::uint32_t const __s = __lock();
+        __read_words(__old);
+        __write_words(__buf);
+        __unlock(__s);
+        _Tp __ret;
+        memcpy(&__ret, __old, sizeof(_Tp));
+        return __ret;
+    }
+
+    // Applies __fn to a copy of the value under the writer lock and publishes the result.
+    // __fn must not throw; the lock would never be released.
+    template <class _Fn>
+    _LIBCUDACXX_HOST_DEVICE
+    void update(_Fn __fn) noexcept {
+        __word_t __buf[__word_count];
+        std::uint32_t const __s = __lock();
+        __read_words(__buf);
+        _Tp __v;
+        memcpy(&__v, __buf, sizeof(_Tp));
+        __fn(__v);
+        memcpy(__buf, &__v, sizeof(_Tp));
+        __write_words(__buf);
+        __unlock(__s);
+    }
+};
+
+// sharded_counter<T>
+
+#if !defined(_LIBCUDACXX_COMPILER_NVRTC)
+// Host threads are dealt slots round-robin on their first update.
+inline size_t __sharded_counter_host_slot() noexcept {
+    static std::atomic<size_t> __next(0);
+    static thread_local size_t const __slot = __next.fetch_add(1, memory_order_relaxed);
+    return __slot;
+}
+#endif // _LIBCUDACXX_COMPILER_NVRTC
+
+// The slot of the calling host thread, or of the calling device warp, among the slots of a
+// sharded object. A thread always gets the same slot.
+_LIBCUDACXX_HOST_DEVICE
+inline size_t __local_shard(size_t __shards) noexcept {
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        return __sharded_counter_host_slot() % __shards;
+    ),(
+        unsigned const __threads = blockDim.x * blockDim.y * blockDim.z;
+        unsigned const __thread = threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+        unsigned const __block = blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z);
+        return (__block * ((__threads + 31) / 32) + __thread / 32) % __shards;
+    ))
+}
+
+// An integral counter split across cache-line-sized slots. Each host thread, or each device
+// warp, adds into its own slot and folds the slot into a shared total only once it has drifted
+// by the batch size, so concurrent increments rarely touch the same cache line. load() sums the
+// total and every slot; load_approx() reads the total alone and may lag by up to
+// _Shards * batch. Updates are relaxed.
+template <class _Tp, thread_scope _Sco = thread_scope::thread_scope_system, size_t _Shards = 64>
+class sharded_counter
+{
+    static_assert(std::is_integral<_Tp>::value && !std::is_same<_Tp, bool>::value,
+        "cuda::sharded_counter<T> requires that 'T' be an integral type");
+    static_assert(_Shards > 0, "cuda::sharded_counter requires at least one shard");
+
+    using __delta_t = typename std::make_signed<_Tp>::type;
+
+    struct alignas(128) __slot {
+        _LIBCUDACXX_HOST_DEVICE
+        __slot() noexcept : __delta(0) {}
+        atomic<__delta_t, _Sco> __delta;
+    };
+
+    alignas(128) atomic<_Tp, _Sco> __total;
+    __slot __slots[_Shards];
+    __delta_t __batch;
+
+    _LIBCUDACXX_HOST_DEVICE
+    __slot& __local() noexcept {
+        return __slots[__local_shard(_Shards)];
+    }
+
+    _LIBCUDACXX_HOST_DEVICE
+    void __add(__delta_t __d) noexcept {
+        if (__d >= __batch || __d <= -__batch) {
+            __total.fetch_add(static_cast<_Tp>(__d), memory_order_relaxed);
+            return;
+        }
+        __slot& __s = __local();
+        __delta_t const __now = static_cast<__delta_t>(__s.__delta.fetch_add(__d, memory_order_relaxed) + __d);
+        if (__now >= __batch || __now <= -__batch) {
+            __delta_t const __folded = __s.__delta.exchange(0, memory_order_relaxed);
+            __total.fetch_add(static_cast<_Tp>(__folded), memory_order_relaxed);
+        }
+    }
+
+public:
+    using value_type = _Tp;
+    static constexpr size_t shard_count = _Shards;
+
+    _LIBCUDACXX_HOST_DEVICE
+    explicit sharded_counter(_Tp __initial = 0, __delta_t __batch_size = 64) noexcept
+        : __total(__initial), __slots(), __batch(__batch_size > 0 ? __batch_size : 1) {}
+
+    sharded_counter(const sharded_counter&) = delete;
+    sharded_counter& operator=(const sharded_counter&) = delete;
+
+    _LIBCUDACXX_HOST_DEVICE
+    void add(_Tp __v) noexcept {__add(static_cast<__delta_t>(__v));}
+    _LIBCUDACXX_HOST_DEVICE
+    void sub(_Tp __v) noexcept {__add(static_cast<__delta_t>(_Tp(0) - __v));}
+
+    // Exact when no update runs concurrently; otherwise in-flight updates may or may not be counted.
+    _LIBCUDACXX_HOST_DEVICE
+    _Tp load() const noexcept {
+        _Tp __sum = __total.load(memory_order_relaxed);
+        for (size_t __i = 0; __i < _Shards; ++__i)
+            __sum = static_cast<_Tp>(__sum + static_cast<_Tp>(__slots[__i].__delta.load(memory_order_relaxed)));
+        return __sum;
+    }
+    _LIBCUDACXX_HOST_DEVICE
+    _Tp load_approx() const noexcept {
+        return __total.load(memory_order_relaxed);
+    }
+    _LIBCUDACXX_HOST_DEVICE
+    operator _Tp() const noexcept {return load();}
+
+    // Not atomic with respect to concurrent updates.
+    _LIBCUDACXX_HOST_DEVICE
+    void reset(_Tp __v = 0) noexcept {
+        for (size_t __i = 0; __i < _Shards; ++__i)
+            __slots[__i].__delta.store(0, memory_order_relaxed);
+        __total.store(__v, memory_order_relaxed);
+    }
+};
+
 _LIBCUDACXX_END_NAMESPACE_CUDA
 
 #endif // _LIBCUDACXX___CUDA_ATOMIC_H
@@ -45,7 +45,7 @@
 
 // pre-define lock free query for heterogeneous compatibility
 #ifndef _LIBCUDACXX_ATOMIC_IS_LOCK_FREE
-#define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(__x) (__x <= 8)
+#define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(__x) (__x <= 8 || _LIBCUDACXX_ATOMIC_IS_WIDE_LOCK_FREE(__x))
 #endif
 
 #ifndef _LIBCUDACXX_COMPILER_NVRTC
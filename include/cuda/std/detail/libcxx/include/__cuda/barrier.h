@@ -52,8 +52,50 @@ enum async_contract_fulfillment
     async
 };
 
-template<thread_scope _Sco, class _CompletionF = _CUDA_VSTD::__empty_completion>
-class barrier : public _CUDA_VSTD::__barrier_base<_CompletionF, _Sco> {
+// Barrier algorithms, selected by the third template parameter of cuda::barrier.
+
+// A single arrival counter: the cheapest barrier for a handful of participants.
+struct barrier_central {
+    template<class _CompletionF, thread_scope _Sco>
+    using __base = _CUDA_VSTD::__barrier_base<_CompletionF, _Sco>;
+};
+
+// A combining tree of counters: arrivals spread over many cache lines, so it scales to many
+// host threads.
+template<class _Storage = barrier_inline_storage<64>>
+struct barrier_tree {
+    template<class _CompletionF, thread_scope _Sco>
+    using __base = _CUDA_VSTD::__algorithm_barrier_base<_CUDA_VSTD::__tree_barrier_algorithm<_Sco>, _CompletionF, _Sco, _Storage>;
+};
+
+// Dissemination: every arrival takes part in ceil(log2 n) rounds of pairwise signals and there is
+// no last arrival to wait for, which suits phases where all threads arrive together.
+template<class _Storage = barrier_inline_storage<64>>
+struct barrier_dissemination {
+    template<class _CompletionF, thread_scope _Sco>
+    using __base = _CUDA_VSTD::__algorithm_barrier_base<_CUDA_VSTD::__dissemination_barrier_algorithm<_Sco>, _CompletionF, _Sco, _Storage>;
+};
+
+// Tournament: a static bracket of pairwise matches in which early arrivals leave after a single
+// flip, which suits phases with badly skewed arrivals.
+template<class _Storage = barrier_inline_storage<64>>
+struct barrier_tournament {
+    template<class _CompletionF, thread_scope _Sco>
+    using __base = _CUDA_VSTD::__algorithm_barrier_base<_CUDA_VSTD::__tournament_barrier_algorithm<_Sco>, _CompletionF, _Sco, _Storage>;
+};
+
+// Hierarchical: arrivals combine within the NUMA domain of the arriving thread first, so each
+// phase moves one cache line per domain, rather than one per arrival, between sockets.
+template<class _Storage = barrier_inline_storage<64>>
+struct barrier_hierarchical {
+    template<class _CompletionF, thread_scope _Sco>
+    using __base = _CUDA_VSTD::__algorithm_barrier_base<_CUDA_VSTD::__hierarchical_barrier_algorithm<_Sco>, _CompletionF, _Sco, _Storage>;
+};
+
+template<thread_scope _Sco, class _CompletionF = _CUDA_VSTD::__empty_completion, class _Algorithm = barrier_central>
+class barrier : public _Algorithm::template __base<_CompletionF, _Sco> {
+    using __algorithm_base = typename _Algorithm::template __base<_CompletionF, _Sco>;
+
 public:
     barrier() = default;
 
@@ -62,7 +104,14 @@ public:
 
     _LIBCUDACXX_INLINE_VISIBILITY _LIBCUDACXX_CONSTEXPR
     barrier(_CUDA_VSTD::ptrdiff_t __expected, _CompletionF __completion = _CompletionF())
-        : _CUDA_VSTD::__barrier_base<_CompletionF, _Sco>(__expected, __completion) {
+        : __algorithm_base(__expected, __completion) {
+    }
+
+    template<class _StorageArg, class... _StorageArgs>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    barrier(_CUDA_VSTD::ptrdiff_t __expected, _CompletionF __completion, _StorageArg&& __arg, _StorageArgs&&... __args)
+        : __algorithm_base(__expected, __completion,
+                           _CUDA_VSTD::forward<_StorageArg>(__arg), _CUDA_VSTD::forward<_StorageArgs>(__args)...) {
     }
 
     _LIBCUDACXX_INLINE_VISIBILITY
@@ -81,6 +130,35 @@ public:
 #endif
         new (__b) barrier(__expected, __completion);
     }
+
+    using arrival_token = typename __algorithm_base::arrival_token;
+
+    // On the host, every arrival waits for the copies in flight against this barrier, so that
+    // the phase they were made in cannot complete before them.
+    _LIBCUDACXX_NODISCARD_ATTRIBUTE _LIBCUDACXX_INLINE_VISIBILITY
+    arrival_token arrive(_CUDA_VSTD::ptrdiff_t __update = 1) {
+        __memcpy_async_host_wait(this);
+        return __algorithm_base::arrive(__update);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void arrive_and_wait() {
+        __memcpy_async_host_wait(this);
+        __algorithm_base::arrive_and_wait();
+    }
+
+    template<class _Backoff>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void arrive_and_wait(_Backoff __backoff) {
+        __memcpy_async_host_wait(this);
+        __algorithm_base::arrive_and_wait(__backoff);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void arrive_and_drop() {
+        __memcpy_async_host_wait(this);
+        __algorithm_base::arrive_and_drop();
+    }
 };
 
 struct __block_scope_barrier_base {};
@@ -186,6 +264,7 @@ public:
         _LIBCUDACXX_DEBUG_ASSERT(__update >= 0);
         _LIBCUDACXX_DEBUG_ASSERT(__expected_unit >=0);
 #endif
+        __memcpy_async_host_wait(this);
         arrival_token __token = {};
         NV_DISPATCH_TARGET(
             NV_PROVIDES_SM_90, (
@@ -474,11 +553,20 @@ private:
 public:
     _LIBCUDACXX_INLINE_VISIBILITY
     void wait(arrival_token && __phase) const {
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_barrier);
         _CUDA_VSTD::__libcpp_thread_poll_with_backoff(_CUDA_VSTD::__barrier_poll_tester_phase<barrier>(this, _CUDA_VSTD::move(__phase)));
     }
 
+    template<class _Backoff>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void wait(arrival_token && __phase, _Backoff __backoff) const {
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_barrier);
+        _CUDA_VSTD::__libcpp_thread_poll_with_backoff(_CUDA_VSTD::__barrier_poll_tester_phase<barrier>(this, _CUDA_VSTD::move(__phase)), _CUDA_VSTD::chrono::nanoseconds::zero(), __backoff);
+    }
+
     _LIBCUDACXX_INLINE_VISIBILITY
     void wait_parity(bool __phase_parity) const {
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_barrier);
         _CUDA_VSTD::__libcpp_thread_poll_with_backoff(_CUDA_VSTD::__barrier_poll_tester_parity<barrier>(this, __phase_parity));
     }
 
@@ -487,8 +575,15 @@ public:
         wait(arrive());
     }
 
+    template<class _Backoff>
+    inline _LIBCUDACXX_INLINE_VISIBILITY
+    void arrive_and_wait(_Backoff __backoff) {
+        wait(arrive(), __backoff);
+    }
+
     _LIBCUDACXX_INLINE_VISIBILITY
     void arrive_and_drop() {
+        __memcpy_async_host_wait(this);
         NV_DISPATCH_TARGET(
             NV_PROVIDES_SM_90, (
                 if (!__isClusterShared(&__barrier)) {
@@ -526,6 +621,7 @@ public:
     template<class _Rep, class _Period>
     _LIBCUDACXX_NODISCARD_ATTRIBUTE _LIBCUDACXX_INLINE_VISIBILITY
     bool try_wait_for(arrival_token && __token, const _CUDA_VSTD::chrono::duration<_Rep, _Period>& __dur) {
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_barrier);
         auto __nanosec = _CUDA_VSTD::chrono::duration_cast<_CUDA_VSTD::chrono::nanoseconds>(__dur);
 
         return __try_wait(_CUDA_VSTD::move(__token), __nanosec);
@@ -540,6 +636,7 @@ public:
     template<class _Rep, class _Period>
     _LIBCUDACXX_NODISCARD_ATTRIBUTE _LIBCUDACXX_INLINE_VISIBILITY
     bool try_wait_parity_for(bool __phase_parity, const _CUDA_VSTD::chrono::duration<_Rep, _Period>& __dur) {
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_barrier);
         auto __nanosec = _CUDA_VSTD::chrono::duration_cast<_CUDA_VSTD::chrono::nanoseconds>(__dur);
 
         return __try_wait_parity(__phase_parity, __nanosec);
@@ -716,11 +813,67 @@ void inline __memcpy_async_sm_dispatch(
     )
 }
 
-template<_CUDA_VSTD::size_t _Native_alignment, typename _Group, typename _Sync>
+// Hands a host copy against __sync to the copy workers, as __host_memcpy_async_start does.
+// Copies against a barrier are counted against it, and those against a pipeline join the calling
+// thread's batch for it. A thread-scope pipeline waits for its copies without arriving on
+// anything, so it copies in place.
+template<typename _Sync, typename... _Args>
+inline bool __memcpy_async_host_start(_Sync & __sync, _Args... __args) {
+    return __host_memcpy_async_start_counted(&__sync, __args...);
+}
+
+template<thread_scope _Sco, typename... _Args>
+inline bool __memcpy_async_host_start(pipeline<_Sco> & __sync, _Args... __args) {
+    return __host_memcpy_async_start(&__sync, __args...);
+}
+
+template<typename... _Args>
+inline bool __memcpy_async_host_start(pipeline<thread_scope_thread> &, _Args...) {
+    return false;
+}
+
+// The host copy for one rank of a group copy. With the streaming hint, and 16-byte alignment,
+// large contiguous copies use non-temporal stores.
+template<_CUDA_VSTD::size_t _Alignment, bool _Streaming>
+struct __memcpy_async_host_copy {
+    static inline void __copy(char * __destination, char const * __source, _CUDA_VSTD::size_t __size,
+                              _CUDA_VSTD::size_t __rank, _CUDA_VSTD::size_t __stride) {
+        if (_Streaming && _Alignment >= 16 && __stride == 1 && __size >= _LIBCUDACXX_HOST_MEMCPY_STREAMING_THRESHOLD) {
+            __host_streaming_memcpy(__destination, __source, __size);
+        }
+        else {
+            __strided_memcpy<_Alignment>(__destination, __source, __size, __rank, __stride);
+        }
+    }
+};
+
+// Copies that cp.async cannot make. On the host, large ones go to the copy workers.
+template<_CUDA_VSTD::size_t _Native_alignment, bool _Streaming, typename _Group, typename _Sync>
 _LIBCUDACXX_INLINE_VISIBILITY
-async_contract_fulfillment inline __memcpy_async(
+async_contract_fulfillment inline __memcpy_async_fallback(
         _Group const & __group, char * __destination, char const * __source,
         _CUDA_VSTD::size_t __size, _Sync & __sync) {
+    NV_IF_ELSE_TARGET(NV_IS_HOST, (
+        __host_copy_fn const __copy = &__memcpy_async_host_copy<_Native_alignment, _Streaming>::__copy;
+        if (__memcpy_async_host_start(__sync, __copy, _Native_alignment,
+                                      __destination, __source, __size, __group.thread_rank(), __group.size())) {
+            return async_contract_fulfillment::async;
+        }
+        __copy(__destination, __source, __size, __group.thread_rank(), __group.size());
+    ), (
+        __unused(__sync);
+        __strided_memcpy<_Native_alignment>(__destination, __source, __size, __group.thread_rank(), __group.size());
+    ))
+    return async_contract_fulfillment::none;
+}
+
+// _Streaming hints that the destination will not be read again soon.
+template<_CUDA_VSTD::size_t _Native_alignment, typename _Group, typename _Sync, bool _Streaming = false>
+_LIBCUDACXX_INLINE_VISIBILITY
+async_contract_fulfillment inline __memcpy_async(
+        _Group const & __group, char * __destination, char const * __source,
+        _CUDA_VSTD::size_t __size, _Sync & __sync,
+        _CUDA_VSTD::integral_constant<bool, _Streaming> = _CUDA_VSTD::integral_constant<bool, _Streaming>()) {
     async_contract_fulfillment __is_async = async_contract_fulfillment::none;
 
     NV_DISPATCH_TARGET(
@@ -754,12 +907,72 @@ async_contract_fulfillment inline __memcpy_async(
 
         __memcpy_arrive_on_impl::__arrive_on(__sync, __is_async);
         , NV_ANY_TARGET,
-            __strided_memcpy<_Native_alignment>(__destination, __source, __size, __group.thread_rank(), __group.size());
+            __is_async = (__memcpy_async_fallback<_Native_alignment, _Streaming>(__group, __destination, __source, __size, __sync));
     )
 
     return __is_async;
 }
 
+// The host side of __memcpy_async_rows. A group with no more threads than rows shares out whole
+// rows, so that each thread copies contiguous runs; a smaller number of rows is shared out as
+// __memcpy_async shares out one.
+template<_CUDA_VSTD::size_t _Native_alignment, typename _Group, typename _Sync>
+async_contract_fulfillment inline __memcpy_async_rows_host(
+        _Group const & __group, char * __destination, char const * __source, _CUDA_VSTD::size_t __size,
+        _CUDA_VSTD::size_t __rows, _CUDA_VSTD::size_t __destination_pitch, _CUDA_VSTD::size_t __source_pitch,
+        _Sync & __sync) {
+    _CUDA_VSTD::size_t __rank = __group.thread_rank();
+    _CUDA_VSTD::size_t __stride = __group.size();
+    if (__stride <= __rows) {
+        __destination += __rank * __destination_pitch;
+        __source += __rank * __source_pitch;
+        __rows = (__rows - __rank + __stride - 1) / __stride;
+        __destination_pitch *= __stride;
+        __source_pitch *= __stride;
+        __rank = 0;
+        __stride = 1;
+    }
+
+    __host_copy_fn const __copy = &__memcpy_async_host_copy<_Native_alignment, false>::__copy;
+    if (__memcpy_async_host_start(__sync, __copy, _Native_alignment, __destination, __source, __size,
+                                  __rank, __stride, __rows, __destination_pitch, __source_pitch)) {
+        return async_contract_fulfillment::async;
+    }
+    for (_CUDA_VSTD::size_t __row = 0; __row < __rows; ++__row) {
+        __copy(__destination + __row * __destination_pitch, __source + __row * __source_pitch, __size, __rank, __stride);
+    }
+    return async_contract_fulfillment::none;
+}
+
+// Copies __rows rows of __size bytes, each __destination_pitch and __source_pitch bytes after
+// the one before, completing against __sync as a single memcpy_async would. On the device each
+// row is a memcpy_async of its own.
+template<_CUDA_VSTD::size_t _Native_alignment, typename _Group, typename _Sync>
+_LIBCUDACXX_INLINE_VISIBILITY
+async_contract_fulfillment inline __memcpy_async_rows(
+        _Group const & __group, char * __destination, char const * __source, _CUDA_VSTD::size_t __size,
+        _CUDA_VSTD::size_t __rows, _CUDA_VSTD::size_t __destination_pitch, _CUDA_VSTD::size_t __source_pitch,
+        _Sync & __sync) {
+    if (__rows == 1) {
+        return __memcpy_async<_Native_alignment>(__group, __destination, __source, __size, __sync);
+    }
+
+    async_contract_fulfillment __is_async = async_contract_fulfillment::none;
+    NV_IF_ELSE_TARGET(NV_IS_HOST, (
+        __is_async = __memcpy_async_rows_host<_Native_alignment>(__group, __destination, __source, __size,
+                                                                 __rows, __destination_pitch, __source_pitch, __sync);
+    ), (
+        for (_CUDA_VSTD::size_t __row = 0; __row < __rows; ++__row) {
+            if (__memcpy_async<_Native_alignment>(__group, __destination + __row * __destination_pitch,
+                                                  __source + __row * __source_pitch, __size, __sync)
+                    == async_contract_fulfillment::async) {
+                __is_async = async_contract_fulfillment::async;
+            }
+        }
+    ))
+    return __is_async;
+}
+
 struct __single_thread_group {
     _LIBCUDACXX_INLINE_VISIBILITY
     void sync() const {}
@@ -769,6 +982,50 @@ struct __single_thread_group {
     constexpr _CUDA_VSTD::size_t thread_rank() const { return 0; };
 };
 
+#if !defined(_LIBCUDACXX_COMPILER_NVRTC)
+// A group of host threads that cooperate as one, for make_pipeline and the group overloads of
+// memcpy_async. The threads share a host_thread_group::shared_state made for their number, and
+// each makes its own host_thread_group from it with a rank of its own.
+class host_thread_group {
+public:
+    class shared_state {
+    public:
+        _LIBCUDACXX_INLINE_VISIBILITY
+        explicit shared_state(_CUDA_VSTD::size_t __size)
+            : __sync(static_cast<_CUDA_VSTD::ptrdiff_t>(__size))
+            , __size(__size) {
+        }
+
+        shared_state(const shared_state &) = delete;
+        shared_state & operator=(const shared_state &) = delete;
+
+    private:
+        barrier<thread_scope_system> __sync;
+        _CUDA_VSTD::size_t __size;
+
+        friend class host_thread_group;
+    };
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    host_thread_group(shared_state & __state, _CUDA_VSTD::size_t __rank)
+        : __state(&__state)
+        , __rank(__rank) {
+        _LIBCUDACXX_ASSERT(__rank < __state.__size, "host_thread_group requires a rank below the group size");
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void sync() const { __state->__sync.arrive_and_wait(); }
+    _LIBCUDACXX_INLINE_VISIBILITY
+    _CUDA_VSTD::size_t size() const { return __state->__size; }
+    _LIBCUDACXX_INLINE_VISIBILITY
+    _CUDA_VSTD::size_t thread_rank() const { return __rank; }
+
+private:
+    shared_state * __state;
+    _CUDA_VSTD::size_t __rank;
+};
+#endif // _LIBCUDACXX_COMPILER_NVRTC
+
 template<typename _Group, class _Tp, thread_scope _Sco, typename _CompF>
 _LIBCUDACXX_INLINE_VISIBILITY
 async_contract_fulfillment memcpy_async(_Group const & __group, _Tp * __destination, _Tp const * __source, _CUDA_VSTD::size_t __size, barrier<_Sco, _CompF> & __barrier) {
@@ -821,6 +1078,34 @@ async_contract_fulfillment memcpy_async(void * __destination, void const * __sou
     return memcpy_async(__single_thread_group{}, __destination, __source, __size, __barrier);
 }
 
+// The alignment memcpy_async may assume for elements of type _Tp and a size of type _Size.
+template<class _Tp, typename _Size>
+struct __memcpy_async_alignment : _CUDA_VSTD::integral_constant<_CUDA_VSTD::size_t, alignof(_Tp)> {};
+
+template<class _Tp, _CUDA_VSTD::size_t _Alignment>
+struct __memcpy_async_alignment<_Tp, aligned_size_t<_Alignment>>
+    : _CUDA_VSTD::integral_constant<_CUDA_VSTD::size_t, (alignof(_Tp) > _Alignment) ? alignof(_Tp) : _Alignment> {};
+
+// Barriers keep no statistics; <cuda/pipeline> overloads this for pipelines.
+template<typename _Group, typename _Sync>
+_LIBCUDACXX_INLINE_VISIBILITY
+void __pipeline_stats_record_bytes(_Group const &, _Sync &, _CUDA_VSTD::size_t) {}
+
+// memcpy_async into a destination that will not be read again soon, as for an annotated_ptr
+// with access_property::streaming. Works with barriers and pipelines alike.
+template<typename _Group, class _Tp, typename _Size, typename _Sync>
+_LIBCUDACXX_INLINE_VISIBILITY
+async_contract_fulfillment __memcpy_async_streaming(_Group const & __group, _Tp * __destination, _Tp const * __source, _Size __size, _Sync & __sync) {
+#if !defined(_LIBCUDACXX_COMPILER_GCC) || _GNUC_VER > 408
+    static_assert(_CUDA_VSTD::is_trivially_copyable<_Tp>::value, "memcpy_async requires a trivially copyable type");
+#endif
+
+    __pipeline_stats_record_bytes(__group, __sync, __size);
+    return __memcpy_async<__memcpy_async_alignment<_Tp, _Size>::value>(
+        __group, reinterpret_cast<char *>(__destination), reinterpret_cast<char const *>(__source), __size, __sync,
+        _CUDA_VSTD::true_type());
+}
+
 _LIBCUDACXX_END_NAMESPACE_CUDA
 
 #endif // _LIBCUDACXX___CUDA_BARRIER_H
@@ -17,12 +17,35 @@
 
 _LIBCUDACXX_BEGIN_NAMESPACE_CUDA
 
-template<thread_scope _Sco>
-class latch : public _CUDA_VSTD::__latch_base<_Sco> {
+// Count-down algorithms for cuda::latch. Each names the base that implements it as __base<_Sco>.
+
+// A single counter that every count_down updates.
+struct latch_central {
+    template<thread_scope _Sco>
+    using __base = _CUDA_VSTD::__latch_base<_Sco>;
+};
+
+// Per NUMA domain shares of the count, so count_down mostly stays within the caller's domain.
+template<class _Storage = barrier_inline_storage<64>>
+struct latch_hierarchical {
+    template<thread_scope _Sco>
+    using __base = _CUDA_VSTD::__hierarchical_latch_base<_Sco, _Storage>;
+};
+
+template<thread_scope _Sco, class _Algorithm = latch_central>
+class latch : public _Algorithm::template __base<_Sco> {
+    using __algorithm_base = typename _Algorithm::template __base<_Sco>;
+
 public:
     _LIBCUDACXX_INLINE_VISIBILITY _LIBCUDACXX_CONSTEXPR
     latch(_CUDA_VSTD::ptrdiff_t __count)
-        : _CUDA_VSTD::__latch_base<_Sco>(__count) {
+        : __algorithm_base(__count) {
+    }
+
+    template<class _StorageArg, class... _StorageArgs>
+    _LIBCUDACXX_INLINE_VISIBILITY
+    latch(_CUDA_VSTD::ptrdiff_t __count, _StorageArg&& __arg, _StorageArgs&&... __args)
+        : __algorithm_base(__count, _CUDA_VSTD::forward<_StorageArg>(__arg), _CUDA_VSTD::forward<_StorageArgs>(__args)...) {
     }
 };
 
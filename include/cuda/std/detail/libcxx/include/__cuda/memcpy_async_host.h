@@ -0,0 +1,601 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_MEMCPY_ASYNC_HOST_H
+#define _LIBCUDACXX___CUDA_MEMCPY_ASYNC_HOST_H
+
+#ifndef __cuda_std__
+#error "<__cuda/memcpy_async_host.h> should only be included in from <cuda/std/barrier>"
+#endif // __cuda_std__
+
+#if defined(_LIBCUDACXX_USE_PRAGMA_GCC_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+// On the host, memcpy_async hands copies of at least _LIBCUDACXX_HOST_MEMCPY_ASYNC_THRESHOLD
+// bytes to a pool of _LIBCUDACXX_HOST_MEMCPY_ASYNC_WORKERS copy threads, started on first use.
+// Copies against a barrier are counted against the barrier, and every arrival on it waits for
+// them, so the phase they were made in cannot complete before they do, whoever made them. The
+// copies a thread issues against one pipeline form a batch, and its next producer_commit on that
+// pipeline leaves the arrival on the stage to whichever thread finishes the batch. Define
+// _LIBCUDACXX_HAS_NO_HOST_MEMCPY_ASYNC to copy in place, as on targets without pthreads.
+
+#if defined(_LIBCUDACXX_HAS_THREAD_API_PTHREAD) && !defined(_LIBCUDACXX_HAS_NO_HOST_MEMCPY_ASYNC)
+#  define _LIBCUDACXX_HAS_HOST_MEMCPY_ASYNC
+#endif
+
+#ifndef _LIBCUDACXX_HOST_MEMCPY_ASYNC_THRESHOLD
+#  define _LIBCUDACXX_HOST_MEMCPY_ASYNC_THRESHOLD (64 * 1024)
+#endif
+
+#ifndef _LIBCUDACXX_HOST_MEMCPY_ASYNC_WORKERS
+#  define _LIBCUDACXX_HOST_MEMCPY_ASYNC_WORKERS 2
+#endif
+
+// Host copies into a destination annotated access_property::streaming, whose alignment is at
+// least 16 bytes, bypass the cache with non-temporal stores from this many contiguous bytes on.
+// Smaller copies are faster through the cache even if the destination is never read.
+#ifndef _LIBCUDACXX_HOST_MEMCPY_STREAMING_THRESHOLD
+#  define _LIBCUDACXX_HOST_MEMCPY_STREAMING_THRESHOLD (4 * 1024 * 1024)
+#endif
+
+#if !defined(_LIBCUDACXX_COMPILER_NVRTC) && (defined(__x86_64__) || defined(_M_X64))
+#  include <immintrin.h>
+#  define _LIBCUDACXX_HAS_HOST_STREAMING_MEMCPY
+#elif !defined(_LIBCUDACXX_COMPILER_NVRTC) && defined(__aarch64__) && !defined(_LIBCUDACXX_COMPILER_MSVC)
+#  define _LIBCUDACXX_HAS_HOST_STREAMING_MEMCPY
+#endif
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+#if defined(_LIBCUDACXX_HAS_HOST_STREAMING_MEMCPY)
+
+// Copies __size bytes between 16-byte aligned buffers with stores that do not allocate in the
+// cache. The destination is first brought to a cache line boundary so that every store fills
+// whole lines, and the stores are fenced before returning, since nothing else orders them. The
+// source is read in order, which the hardware prefetchers follow better than software prefetches.
+inline void __host_streaming_memcpy(char * __destination, char const * __source, _CUDA_VSTD::size_t __size) {
+    _CUDA_VSTD::size_t __head = (64 - reinterpret_cast<_CUDA_VSTD::uintptr_t>(__destination) % 64) % 64;
+    if (__head > __size)
+        __head = __size;
+    memcpy(__destination, __source, __head);
+    __destination += __head;
+    __source += __head;
+    __size -= __head;
+
+    _CUDA_VSTD::size_t const __lines = __size / 64;
+    for (_CUDA_VSTD::size_t __i = 0; __i < __lines; ++__i, __destination += 64, __source += 64) {
+#if defined(__x86_64__) || defined(_M_X64)
+#  if defined(__AVX512F__)
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(__destination),
+                            _mm512_loadu_si512(reinterpret_cast<void const *>(__source)));
+#  elif defined(__AVX__)
+        __m256i const __lo = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(__source));
+        __m256i const __hi = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(__source + 32));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(__destination), __lo);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(__destination + 32), __hi);
+#  else
+        __m128i const __a = _mm_load_si128(reinterpret_cast<__m128i const *>(__source));
+        __m128i const __b = _mm_load_si128(reinterpret_cast<__m128i const *>(__source + 16));
+        __m128i const __c = _mm_load_si128(reinterpret_cast<__m128i const *>(__source + 32));
+        __m128i const __d = _mm_load_si128(reinterpret_cast<__m128i const *>(__source + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(__destination), __a);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(__destination + 16), __b);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(__destination + 32), __c);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(__destination + 48), __d);
+#  endif
+#else
+        asm volatile ("ldp q0, q1, [%1]\n\t"
+                      "ldp q2, q3, [%1, #32]\n\t"
+                      "stnp q0, q1, [%0]\n\t"
+                      "stnp q2, q3, [%0, #32]"
+                      :: "r"(__destination), "r"(__source)
+                      : "v0", "v1", "v2", "v3", "memory");
+#endif
+    }
+#if defined(__x86_64__) || defined(_M_X64)
+    _mm_sfence();
+#endif
+
+    memcpy(__destination, __source, __size % 64);
+}
+
+#else // _LIBCUDACXX_HAS_HOST_STREAMING_MEMCPY
+
+inline void __host_streaming_memcpy(char * __destination, char const * __source, _CUDA_VSTD::size_t __size) {
+    memcpy(__destination, __source, __size);
+}
+
+#endif // _LIBCUDACXX_HAS_HOST_STREAMING_MEMCPY
+
+// Copies the elements of one rank of a strided group copy, as __strided_memcpy does.
+typedef void (*__host_copy_fn)(char *, char const *, _CUDA_VSTD::size_t, _CUDA_VSTD::size_t, _CUDA_VSTD::size_t);
+
+#if defined(_LIBCUDACXX_HAS_HOST_MEMCPY_ASYNC)
+
+// A set of copies in flight. __pending counts them, plus for a pipeline a reference the issuing
+// thread holds until it closes the batch; whoever drops the last reference runs __complete,
+// frees the batch, and takes it off the count of closed batches still in flight, __closed, of
+// the thread that issued it, if any.
+struct __host_copy_batch {
+    _CUDA_VSTD::atomic<_CUDA_VSTD::ptrdiff_t> __pending;
+    void (*__complete)(void *);
+    void * __arg;
+    _CUDA_VSTD::atomic<_CUDA_VSTD::ptrdiff_t> * __closed;
+
+    inline void __release() {
+        if (__pending.fetch_sub(1, _CUDA_VSTD::memory_order_acq_rel) == 1) {
+            _CUDA_VSTD::atomic<_CUDA_VSTD::ptrdiff_t> * const __closed_count = __closed;
+            __complete(__arg);
+            delete this;
+            if (__closed_count != nullptr)
+                __closed_count->fetch_sub(1, _CUDA_VSTD::memory_order_release);
+        }
+    }
+};
+
+// Copies __rows runs of __size bytes, each __destination_pitch and __source_pitch bytes after
+// the one before.
+struct __host_copy_task {
+    __host_copy_task * __next;
+    __host_copy_fn __copy;
+    char * __destination;
+    char const * __source;
+    _CUDA_VSTD::size_t __size;
+    _CUDA_VSTD::size_t __rank;
+    _CUDA_VSTD::size_t __stride;
+    _CUDA_VSTD::size_t __rows;
+    _CUDA_VSTD::size_t __destination_pitch;
+    _CUDA_VSTD::size_t __source_pitch;
+    __host_copy_batch * __batch;
+
+    inline void __run() const {
+        for (_CUDA_VSTD::size_t __row = 0; __row < __rows; ++__row)
+            __copy(__destination + __row * __destination_pitch, __source + __row * __source_pitch,
+                   __size, __rank, __stride);
+    }
+};
+
+// The copy worker threads and their FIFO of tasks. The workers drain the queue before the
+// engine is torn down at exit.
+class __host_copy_engine {
+    _CUDA_VSTD::__libcpp_mutex_t __mutex = _LIBCUDACXX_MUTEX_INITIALIZER;
+    _CUDA_VSTD::__libcpp_condvar_t __ready = _LIBCUDACXX_CONDVAR_INITIALIZER;
+    __host_copy_task * __head = nullptr;
+    __host_copy_task ** __tail = &__head;
+    bool __stop = false;
+    _CUDA_VSTD::__libcpp_thread_t __workers[_LIBCUDACXX_HOST_MEMCPY_ASYNC_WORKERS];
+    _CUDA_VSTD::size_t __worker_count = 0;
+
+    static void * __run(void * __arg) {
+        __host_copy_engine & __engine = *static_cast<__host_copy_engine *>(__arg);
+        for (;;) {
+            _CUDA_VSTD::__libcpp_mutex_lock(&__engine.__mutex);
+            while (__engine.__head == nullptr && !__engine.__stop)
+                _CUDA_VSTD::__libcpp_condvar_wait(&__engine.__ready, &__engine.__mutex);
+            __host_copy_task * const __task = __engine.__head;
+            if (__task != nullptr && (__engine.__head = __task->__next) == nullptr)
+                __engine.__tail = &__engine.__head;
+            _CUDA_VSTD::__libcpp_mutex_unlock(&__engine.__mutex);
+            if (__task == nullptr)
+                return nullptr;
+            __task->__run();
+            __task->__batch->__release();
+            delete __task;
+        }
+    }
+
+    __host_copy_engine() {
+        for (_CUDA_VSTD::size_t __i = 0; __i < _LIBCUDACXX_HOST_MEMCPY_ASYNC_WORKERS; ++__i)
+            if (_CUDA_VSTD::__libcpp_thread_create(&__workers[__worker_count], &__run, this) == 0)
+                ++__worker_count;
+    }
+
+public:
+    __host_copy_engine(__host_copy_engine const &) = delete;
+    __host_copy_engine & operator=(__host_copy_engine const &) = delete;
+
+    ~__host_copy_engine() {
+        _CUDA_VSTD::__libcpp_mutex_lock(&__mutex);
+        __stop = true;
+        _CUDA_VSTD::__libcpp_condvar_broadcast(&__ready);
+        _CUDA_VSTD::__libcpp_mutex_unlock(&__mutex);
+        for (_CUDA_VSTD::size_t __i = 0; __i < __worker_count; ++__i)
+            _CUDA_VSTD::__libcpp_thread_join(&__workers[__i]);
+    }
+
+    static __host_copy_engine & __get() {
+        static __host_copy_engine __engine;
+        return __engine;
+    }
+
+    _CUDA_VSTD::size_t __workers_running() const noexcept {
+        return __worker_count;
+    }
+
+    // Queues the tasks __first to __last, linked through __next.
+    void __push(__host_copy_task * __first, __host_copy_task * __last) {
+        _CUDA_VSTD::__libcpp_mutex_lock(&__mutex);
+        *__tail = __first;
+        __tail = &__last->__next;
+        _CUDA_VSTD::__libcpp_condvar_broadcast(&__ready);
+        _CUDA_VSTD::__libcpp_mutex_unlock(&__mutex);
+    }
+};
+
+// The number of copies in flight against each barrier, by the barrier's address. A slot whose
+// count is zero is free, and __in_flight, their total, lets arrivals on barriers skip the table
+// while no copies are in flight at all. Slots are handed out under __mutex; copies count down
+// without it.
+class __host_copy_tracker {
+public:
+    struct __slot {
+        _CUDA_VSTD::atomic<void const *> __key;
+        _CUDA_VSTD::atomic<_CUDA_VSTD::ptrdiff_t> __count;
+    };
+
+private:
+    static constexpr _CUDA_VSTD::size_t __slot_count = 64;
+
+    _CUDA_VSTD::__libcpp_mutex_t __mutex = _LIBCUDACXX_MUTEX_INITIALIZER;
+    __slot __slots[__slot_count];
+    _CUDA_VSTD::atomic<_CUDA_VSTD::ptrdiff_t> __in_flight;
+
+    __host_copy_tracker() noexcept : __slots(), __in_flight(0) { }
+
+    // The slot counting copies against __key, or nullptr. __mutex must be held.
+    __slot * __find(void const * __key) noexcept {
+        for (__slot & __s : __slots)
+            if (__s.__key.load(_CUDA_VSTD::memory_order_relaxed) == __key &&
+                __s.__count.load(_CUDA_VSTD::memory_order_relaxed) != 0)
+                return &__s;
+        return nullptr;
+    }
+
+public:
+    __host_copy_tracker(__host_copy_tracker const &) = delete;
+    __host_copy_tracker & operator=(__host_copy_tracker const &) = delete;
+
+    static __host_copy_tracker & __get() noexcept {
+        static __host_copy_tracker __tracker;
+        return __tracker;
+    }
+
+    // Counts __n more copies in flight against __key. Returns nullptr if every slot is taken.
+    __slot * __add(void const * __key, _CUDA_VSTD::ptrdiff_t __n) noexcept {
+        _CUDA_VSTD::__libcpp_mutex_lock(&__mutex);
+        __slot * __s = __find(__key);
+        for (_CUDA_VSTD::size_t __i = 0; __s == nullptr && __i < __slot_count; ++__i)
+            if (__slots[__i].__count.load(_CUDA_VSTD::memory_order_acquire) == 0) {
+                __s = &__slots[__i];
+                __s->__key.store(__key, _CUDA_VSTD::memory_order_release);
+            }
+        if (__s != nullptr) {
+            __s->__count.fetch_add(__n, _CUDA_VSTD::memory_order_relaxed);
+            __in_flight.fetch_add(__n, _CUDA_VSTD::memory_order_relaxed);
+        }
+        _CUDA_VSTD::__libcpp_mutex_unlock(&__mutex);
+        return __s;
+    }
+
+    void __done(__slot & __s) noexcept {
+        __s.__count.fetch_sub(1, _CUDA_VSTD::memory_order_release);
+        __in_flight.fetch_sub(1, _CUDA_VSTD::memory_order_release);
+    }
+
+    // Waits until no copies counted against __key before the call are in flight.
+    void __wait(void const * __key) {
+        if (__in_flight.load(_CUDA_VSTD::memory_order_acquire) == 0)
+            return;
+        _CUDA_VSTD::__libcpp_mutex_lock(&__mutex);
+        __slot * const __s = __find(__key);
+        _CUDA_VSTD::__libcpp_mutex_unlock(&__mutex);
+        if (__s == nullptr)
+            return;
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_barrier);
+        _CUDA_VSTD::__libcpp_thread_poll_with_backoff([__s, __key]() {
+            return __s->__count.load(_CUDA_VSTD::memory_order_acquire) == 0 ||
+                   __s->__key.load(_CUDA_VSTD::memory_order_acquire) != __key;
+        });
+    }
+};
+
+// The calling thread's open batches, by the address of their pipeline. A thread with every
+// entry taken copies in place until it closes one.
+struct __host_copy_batches {
+    void const * __keys[8];
+    __host_copy_batch * __batches[8];
+    int __count;
+    _CUDA_VSTD::atomic<_CUDA_VSTD::ptrdiff_t> __closed;
+
+    // Waits for the batches this thread has closed, which count down __closed when done.
+    inline void __quiesce() {
+        if (__closed.load(_CUDA_VSTD::memory_order_acquire) == 0)
+            return;
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_barrier);
+        _CUDA_VSTD::__libcpp_thread_poll_with_backoff([this]() {
+            return __closed.load(_CUDA_VSTD::memory_order_acquire) == 0;
+        });
+    }
+
+    inline ~__host_copy_batches() {
+        __quiesce();
+    }
+
+    inline __host_copy_batch * __open(void const * __key) {
+        for (int __i = 0; __i < __count; ++__i)
+            if (__keys[__i] == __key)
+                return __batches[__i];
+        if (__count == 8)
+            return nullptr;
+        __host_copy_batch * const __batch = new __host_copy_batch{{1}, nullptr, nullptr, &__closed};
+        __keys[__count] = __key;
+        __batches[__count] = __batch;
+        ++__count;
+        return __batch;
+    }
+
+    inline __host_copy_batch * __take(void const * __key) noexcept {
+        for (int __i = 0; __i < __count; ++__i) {
+            if (__keys[__i] == __key) {
+                __host_copy_batch * const __batch = __batches[__i];
+                --__count;
+                __keys[__i] = __keys[__count];
+                __batches[__i] = __batches[__count];
+                return __batch;
+            }
+        }
+        return nullptr;
+    }
+};
+
+inline __host_copy_batches & __host_copy_local() noexcept {
+    static thread_local __host_copy_batches __batches{{}, {}, 0, {0}};
+    return __batches;
+}
+
+// Whether a copy of __total bytes is large enough to be worth handing to the workers, and any
+// are running to take it.
+inline bool __host_copy_worth_starting(_CUDA_VSTD::size_t __total) {
+    return __total != 0 && __total >= _LIBCUDACXX_HOST_MEMCPY_ASYNC_THRESHOLD &&
+           __host_copy_engine::__get().__workers_running() != 0;
+}
+
+// Queues the copy of __rows runs of __size bytes, as for __host_copy_task, as part of __batch,
+// splitting a single contiguous run, or the rows, between the workers.
+inline void __host_copy_queue(__host_copy_batch * __batch, __host_copy_fn __copy, _CUDA_VSTD::size_t __alignment,
+                              char * __destination, char const * __source, _CUDA_VSTD::size_t __size,
+                              _CUDA_VSTD::size_t __rank, _CUDA_VSTD::size_t __stride, _CUDA_VSTD::size_t __rows,
+                              _CUDA_VSTD::size_t __destination_pitch, _CUDA_VSTD::size_t __source_pitch) {
+    _CUDA_VSTD::size_t const __threshold = _LIBCUDACXX_HOST_MEMCPY_ASYNC_THRESHOLD;
+    _CUDA_VSTD::size_t const __total = __size * __rows;
+    __host_copy_engine & __engine = __host_copy_engine::__get();
+
+    _CUDA_VSTD::size_t __chunks = 1;
+    if (__stride == 1 || __rows > 1) {
+        __chunks = __engine.__workers_running();
+        if (__threshold != 0 && __total / __threshold < __chunks)
+            __chunks = __total / __threshold;
+    }
+
+    __host_copy_task * __first = nullptr;
+    __host_copy_task ** __link = &__first;
+    __host_copy_task * __last = nullptr;
+    _CUDA_VSTD::ptrdiff_t __tasks = 0;
+#ifndef _LIBCUDACXX_NO_EXCEPTIONS
+    try {
+#endif
+    if (__rows > 1) {
+        _CUDA_VSTD::size_t const __chunk = (__rows + __chunks - 1) / __chunks;
+        _CUDA_VSTD::size_t __row = 0;
+        do {
+            _CUDA_VSTD::size_t const __count = __rows - __row > __chunk ? __chunk : __rows - __row;
+            __last = new __host_copy_task{nullptr, __copy, __destination + __row * __destination_pitch,
+                                          __source + __row * __source_pitch, __size, __rank, __stride,
+                                          __count, __destination_pitch, __source_pitch, __batch};
+            *__link = __last;
+            __link = &__last->__next;
+            ++__tasks;
+            __row += __count;
+        } while (__row < __rows);
+    }
+    else {
+        _CUDA_VSTD::size_t __chunk = (__size + __chunks - 1) / __chunks;
+        __chunk = (__chunk + __alignment - 1) / __alignment * __alignment;
+        _CUDA_VSTD::size_t __offset = 0;
+        do {
+            _CUDA_VSTD::size_t const __length = __stride == 1 && __size - __offset > __chunk ? __chunk : __size - __offset;
+            __last = new __host_copy_task{nullptr, __copy, __destination + __offset, __source + __offset,
+                                          __length, __rank, __stride, 1, 0, 0, __batch};
+            *__link = __last;
+            __link = &__last->__next;
+            ++__tasks;
+            __offset += __length;
+        } while (__offset < __size);
+    }
+#ifndef _LIBCUDACXX_NO_EXCEPTIONS
+    }
+    catch (...) {
+        // Nothing has been pushed yet: the tasks made so far are still ours to free.
+        while (__first != nullptr) {
+            __host_copy_task * const __next = __first->__next;
+            delete __first;
+            __first = __next;
+        }
+        throw;
+    }
+#endif
+
+    __batch->__pending.fetch_add(__tasks, _CUDA_VSTD::memory_order_relaxed);
+    __engine.__push(__first, __last);
+}
+
+// Starts the copy of __rows runs of __size bytes, as for __host_copy_task, in the background as
+// part of the calling thread's batch for the pipeline __key. Returns false, having copied
+// nothing, if the copy is too small to be worth handing off or no worker can take it.
+inline bool __host_memcpy_async_start(void const * __key, __host_copy_fn __copy, _CUDA_VSTD::size_t __alignment,
+                                      char * __destination, char const * __source, _CUDA_VSTD::size_t __size,
+                                      _CUDA_VSTD::size_t __rank, _CUDA_VSTD::size_t __stride,
+                                      _CUDA_VSTD::size_t __rows = 1, _CUDA_VSTD::size_t __destination_pitch = 0,
+                                      _CUDA_VSTD::size_t __source_pitch = 0) {
+    if (!__host_copy_worth_starting(__size * __rows))
+        return false;
+    __host_copy_batch * const __batch = __host_copy_local().__open(__key);
+    if (__batch == nullptr)
+        return false;
+    __host_copy_queue(__batch, __copy, __alignment, __destination, __source, __size, __rank, __stride,
+                      __rows, __destination_pitch, __source_pitch);
+    return true;
+}
+
+// As __host_memcpy_async_start, for the barrier __key: the copy is counted against the barrier
+// until it is done, rather than joining a batch of the calling thread.
+inline bool __host_memcpy_async_start_counted(void const * __key, __host_copy_fn __copy, _CUDA_VSTD::size_t __alignment,
+                                              char * __destination, char const * __source, _CUDA_VSTD::size_t __size,
+                                              _CUDA_VSTD::size_t __rank, _CUDA_VSTD::size_t __stride,
+                                              _CUDA_VSTD::size_t __rows = 1, _CUDA_VSTD::size_t __destination_pitch = 0,
+                                              _CUDA_VSTD::size_t __source_pitch = 0) {
+    if (!__host_copy_worth_starting(__size * __rows))
+        return false;
+    auto const __done = [](void * __s) {
+        __host_copy_tracker::__get().__done(*static_cast<__host_copy_tracker::__slot *>(__s));
+    };
+    // Allocate before counting the copy: a count left behind by a throw would never reach zero.
+    __host_copy_batch * const __batch = new __host_copy_batch{{0}, __done, nullptr, nullptr};
+    __host_copy_tracker::__slot * const __slot = __host_copy_tracker::__get().__add(__key, 1);
+    if (__slot == nullptr) {
+        delete __batch;
+        return false;
+    }
+    __batch->__arg = __slot;
+#ifndef _LIBCUDACXX_NO_EXCEPTIONS
+    try {
+#endif
+    __host_copy_queue(__batch, __copy, __alignment, __destination, __source, __size, __rank, __stride,
+                      __rows, __destination_pitch, __source_pitch);
+#ifndef _LIBCUDACXX_NO_EXCEPTIONS
+    }
+    catch (...) {
+        __host_copy_tracker::__get().__done(*__slot);
+        delete __batch;
+        throw;
+    }
+#endif
+    return true;
+}
+
+// Closes the calling thread's batch for __key: __complete(__arg) runs once its copies are done,
+// on whichever thread finishes last. Returns false if there is no such batch, leaving the
+// caller to do what __complete would have.
+inline bool __host_memcpy_async_commit(void const * __key, void (*__complete)(void *), void * __arg) {
+    __host_copy_batches & __local = __host_copy_local();
+    if (__local.__count == 0)
+        return false;
+    __host_copy_batch * const __batch = __local.__take(__key);
+    if (__batch == nullptr)
+        return false;
+    __batch->__complete = __complete;
+    __batch->__arg = __arg;
+    __local.__closed.fetch_add(1, _CUDA_VSTD::memory_order_relaxed);
+    __batch->__release();
+    return true;
+}
+
+// Waits for the copies in flight against the barrier __key.
+inline void __host_memcpy_async_wait(void const * __key) {
+    __host_copy_tracker::__get().__wait(__key);
+}
+
+// Waits for the calling thread's batch for the pipeline __key.
+inline void __host_memcpy_async_wait_batch(void const * __key) {
+    _CUDA_VSTD::atomic<bool> __done(false);
+    auto const __signal = [](void * __flag) {
+        static_cast<_CUDA_VSTD::atomic<bool> *>(__flag)->store(true, _CUDA_VSTD::memory_order_release);
+    };
+    if (!__host_memcpy_async_commit(__key, __signal, &__done))
+        return;
+    _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_barrier);
+    _CUDA_VSTD::__libcpp_thread_poll_with_backoff([&__done]() {
+        return __done.load(_CUDA_VSTD::memory_order_acquire);
+    });
+}
+
+// Waits for all the calling thread's copies for __key, and for everything its earlier commits
+// left to the copy workers, so that nothing the thread started still touches the barriers.
+inline void __host_memcpy_async_quit(void const * __key) {
+    __host_memcpy_async_wait_batch(__key);
+    __host_copy_local().__quiesce();
+}
+
+#else // _LIBCUDACXX_HAS_HOST_MEMCPY_ASYNC
+
+inline bool __host_memcpy_async_start(void const *, __host_copy_fn, _CUDA_VSTD::size_t, char *, char const *,
+                                      _CUDA_VSTD::size_t, _CUDA_VSTD::size_t, _CUDA_VSTD::size_t,
+                                      _CUDA_VSTD::size_t = 1, _CUDA_VSTD::size_t = 0, _CUDA_VSTD::size_t = 0) {
+    return false;
+}
+
+inline bool __host_memcpy_async_start_counted(void const *, __host_copy_fn, _CUDA_VSTD::size_t, char *, char const *,
+                                              _CUDA_VSTD::size_t, _CUDA_VSTD::size_t, _CUDA_VSTD::size_t,
+                                              _CUDA_VSTD::size_t = 1, _CUDA_VSTD::size_t = 0, _CUDA_VSTD::size_t = 0) {
+    return false;
+}
+
+inline bool __host_memcpy_async_commit(void const *, void (*)(void *), void *) {
+    return false;
+}
+
+inline void __host_memcpy_async_wait(void const *) {}
+
+inline void __host_memcpy_async_quit(void const *) {}
+
+#endif // _LIBCUDACXX_HAS_HOST_MEMCPY_ASYNC
+
+// The same, callable from host and device code; on the device they do nothing.
+
+_LIBCUDACXX_INLINE_VISIBILITY
+inline void __memcpy_async_host_wait(void const * __key) {
+    NV_IF_ELSE_TARGET(NV_IS_HOST, (
+        __host_memcpy_async_wait(__key);
+    ), (
+        (void)__key;
+    ))
+}
+
+_LIBCUDACXX_INLINE_VISIBILITY
+inline void __memcpy_async_host_quit(void const * __key) {
+    NV_IF_ELSE_TARGET(NV_IS_HOST, (
+        __host_memcpy_async_quit(__key);
+    ), (
+        (void)__key;
+    ))
+}
+
+// Arrives on __barrier once the calling thread's batch for __key is done, or at once if it has
+// none.
+template<class _Barrier>
+_LIBCUDACXX_INLINE_VISIBILITY
+inline void __memcpy_async_host_arrive(void const * __key, _Barrier & __barrier) {
+    NV_IF_TARGET(NV_IS_HOST, (
+        auto const __arrive = [](void * __b) {
+            (void)static_cast<_Barrier *>(__b)->arrive();
+        };
+        if (__host_memcpy_async_commit(__key, __arrive, &__barrier))
+            return;
+    ), (
+        (void)__key;
+    ))
+    (void)__barrier.arrive();
+}
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_MEMCPY_ASYNC_HOST_H
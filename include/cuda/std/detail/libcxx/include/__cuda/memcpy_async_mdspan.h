@@ -0,0 +1,156 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_MEMCPY_ASYNC_MDSPAN_H
+#define _LIBCUDACXX___CUDA_MEMCPY_ASYNC_MDSPAN_H
+
+#ifndef __cuda_std__
+#error "<__cuda/memcpy_async_mdspan.h> should only be included in from <cuda/std/barrier>"
+#endif // __cuda_std__
+
+#if defined(_LIBCUDACXX_USE_PRAGMA_GCC_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+#if defined(_LIBCUDACXX_HAS_MEMCPY_ASYNC_MDSPAN)
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// memcpy_async between two mdspans of equal extents, in any layout, as a single copy against
+// __sync. Dimensions along which both sides are contiguous are merged into runs of elements;
+// one more dimension gives the rows of a two-dimensional copy of such runs, repeated over the
+// others. A row-major tile of a row-major matrix, say, is one copy of a run per row.
+template<typename _Group, class _Tp, class _DstExtents, class _DstLayout,
+         class _SrcElement, class _SrcExtents, class _SrcLayout, typename _Sync>
+_LIBCUDACXX_INLINE_VISIBILITY
+async_contract_fulfillment __memcpy_async_mdspan(
+        _Group const & __group,
+        _CUDA_VSTD::mdspan<_Tp, _DstExtents, _DstLayout> const & __destination,
+        _CUDA_VSTD::mdspan<_SrcElement, _SrcExtents, _SrcLayout> const & __source,
+        _Sync & __sync) {
+    static_assert(_CUDA_VSTD::is_same<_CUDA_VSTD::__remove_const_t<_SrcElement>, _Tp>::value,
+                  "memcpy_async requires mdspans of the same element type");
+    static_assert(_DstExtents::rank() == _SrcExtents::rank(), "memcpy_async requires mdspans of the same rank");
+    static_assert(_CUDA_VSTD::mdspan<_Tp, _DstExtents, _DstLayout>::is_always_unique(),
+                  "memcpy_async requires a destination that maps each index to its own element");
+#if !defined(_LIBCUDACXX_COMPILER_GCC) || _GNUC_VER > 408
+    static_assert(_CUDA_VSTD::is_trivially_copyable<_Tp>::value, "memcpy_async requires a trivially copyable type");
+#endif
+
+    constexpr _CUDA_VSTD::size_t __rank = _DstExtents::rank();
+    _CUDA_VSTD::size_t __extent[__rank + 1];
+    bool __merged[__rank + 1];
+    for (_CUDA_VSTD::size_t __d = 0; __d < __rank; ++__d) {
+        _LIBCUDACXX_ASSERT(__destination.extent(__d) == __source.extent(__d),
+                           "memcpy_async requires mdspans of the same extents");
+        __extent[__d] = static_cast<_CUDA_VSTD::size_t>(__destination.extent(__d));
+        if (__extent[__d] == 0) {
+            return async_contract_fulfillment::none;
+        }
+        __merged[__d] = __extent[__d] == 1;
+    }
+
+    // Grow the run of contiguous elements by whole dimensions while both sides allow it.
+    _CUDA_VSTD::size_t __run = 1;
+    for (bool __grown = true; __grown; ) {
+        __grown = false;
+        for (_CUDA_VSTD::size_t __d = 0; __d < __rank; ++__d) {
+            if (!__merged[__d] &&
+                static_cast<_CUDA_VSTD::size_t>(__destination.stride(__d)) == __run &&
+                static_cast<_CUDA_VSTD::size_t>(__source.stride(__d)) == __run) {
+                __run *= __extent[__d];
+                __merged[__d] = true;
+                __grown = true;
+            }
+        }
+    }
+
+    // The longest dimension left gives the rows; the others are walked one row set at a time.
+    _CUDA_VSTD::size_t __outer[__rank + 1];
+    _CUDA_VSTD::size_t __outer_count = 0;
+    _CUDA_VSTD::size_t __row_dimension = __rank;
+    for (_CUDA_VSTD::size_t __d = 0; __d < __rank; ++__d) {
+        if (!__merged[__d] && (__row_dimension == __rank || __extent[__d] > __extent[__row_dimension])) {
+            __row_dimension = __d;
+        }
+    }
+    for (_CUDA_VSTD::size_t __d = 0; __d < __rank; ++__d) {
+        if (!__merged[__d] && __d != __row_dimension) {
+            __outer[__outer_count++] = __d;
+        }
+    }
+
+    _CUDA_VSTD::size_t __rows = 1;
+    _CUDA_VSTD::size_t __destination_pitch = 0;
+    _CUDA_VSTD::size_t __source_pitch = 0;
+    if (__row_dimension != __rank) {
+        __rows = __extent[__row_dimension];
+        __destination_pitch = static_cast<_CUDA_VSTD::size_t>(__destination.stride(__row_dimension)) * sizeof(_Tp);
+        __source_pitch = static_cast<_CUDA_VSTD::size_t>(__source.stride(__row_dimension)) * sizeof(_Tp);
+    }
+
+    char * const __destination_data = reinterpret_cast<char *>(__destination.data_handle());
+    char const * const __source_data = reinterpret_cast<char const *>(__source.data_handle());
+    async_contract_fulfillment __is_async = async_contract_fulfillment::none;
+    _CUDA_VSTD::size_t __index[__rank + 1] = {};
+    for (;;) {
+        _CUDA_VSTD::size_t __destination_offset = 0;
+        _CUDA_VSTD::size_t __source_offset = 0;
+        for (_CUDA_VSTD::size_t __k = 0; __k < __outer_count; ++__k) {
+            __destination_offset += __index[__k] * static_cast<_CUDA_VSTD::size_t>(__destination.stride(__outer[__k]));
+            __source_offset += __index[__k] * static_cast<_CUDA_VSTD::size_t>(__source.stride(__outer[__k]));
+        }
+        if (__memcpy_async_rows<alignof(_Tp)>(__group,
+                __destination_data + __destination_offset * sizeof(_Tp), __source_data + __source_offset * sizeof(_Tp),
+                __run * sizeof(_Tp), __rows, __destination_pitch, __source_pitch, __sync)
+                == async_contract_fulfillment::async) {
+            __is_async = async_contract_fulfillment::async;
+        }
+
+        _CUDA_VSTD::size_t __k = 0;
+        for (; __k < __outer_count; ++__k) {
+            if (++__index[__k] < __extent[__outer[__k]]) {
+                break;
+            }
+            __index[__k] = 0;
+        }
+        if (__k == __outer_count) {
+            break;
+        }
+    }
+    return __is_async;
+}
+
+template<typename _Group, class _Tp, class _DstExtents, class _DstLayout,
+         class _SrcElement, class _SrcExtents, class _SrcLayout, thread_scope _Sco, typename _CompF>
+_LIBCUDACXX_INLINE_VISIBILITY
+async_contract_fulfillment memcpy_async(_Group const & __group,
+        _CUDA_VSTD::mdspan<_Tp, _DstExtents, _DstLayout> const & __destination,
+        _CUDA_VSTD::mdspan<_SrcElement, _SrcExtents, _SrcLayout> const & __source,
+        barrier<_Sco, _CompF> & __barrier) {
+    return __memcpy_async_mdspan(__group, __destination, __source, __barrier);
+}
+
+template<class _Tp, class _DstExtents, class _DstLayout,
+         class _SrcElement, class _SrcExtents, class _SrcLayout, thread_scope _Sco, typename _CompF>
+_LIBCUDACXX_INLINE_VISIBILITY
+async_contract_fulfillment memcpy_async(
+        _CUDA_VSTD::mdspan<_Tp, _DstExtents, _DstLayout> const & __destination,
+        _CUDA_VSTD::mdspan<_SrcElement, _SrcExtents, _SrcLayout> const & __source,
+        barrier<_Sco, _CompF> & __barrier) {
+    return __memcpy_async_mdspan(__single_thread_group{}, __destination, __source, __barrier);
+}
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX_HAS_MEMCPY_ASYNC_MDSPAN
+
+#endif // _LIBCUDACXX___CUDA_MEMCPY_ASYNC_MDSPAN_H
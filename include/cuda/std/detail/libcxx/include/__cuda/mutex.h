@@ -0,0 +1,331 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_MUTEX_H
+#define _LIBCUDACXX___CUDA_MUTEX_H
+
+#ifndef __cuda_std__
+#error "<__cuda/mutex> should only be included in from <cuda/std/mutex>"
+#endif // __cuda_std__
+
+#if defined(_LIBCUDACXX_USE_PRAGMA_GCC_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+template<thread_scope _Sco>
+class mutex : public _CUDA_VSTD::__atomic_mutex_base<_Sco>
+{
+public:
+    _LIBCUDACXX_INLINE_VISIBILITY _LIBCUDACXX_CONSTEXPR
+    mutex() noexcept = default;
+    ~mutex() = default;
+
+    mutex(const mutex&) = delete;
+    mutex& operator=(const mutex&) = delete;
+};
+
+template<thread_scope _Sco>
+class timed_mutex : public _CUDA_VSTD::__atomic_timed_mutex_base<_Sco>
+{
+public:
+    _LIBCUDACXX_INLINE_VISIBILITY _LIBCUDACXX_CONSTEXPR
+    timed_mutex() noexcept = default;
+    ~timed_mutex() = default;
+
+    timed_mutex(const timed_mutex&) = delete;
+    timed_mutex& operator=(const timed_mutex&) = delete;
+};
+
+// Queue locks. Each waiter waits on the locked flag of a node of its own, and each unlock writes
+// only the next waiter's node, so a handoff costs a constant amount of remote traffic however
+// many threads are queued, and waiters are served in arrival order.
+
+// The node a host thread or device thread tries first when claiming from a __queue_lock_pool.
+_LIBCUDACXX_INLINE_VISIBILITY
+inline size_t __queue_lock_home(size_t __nodes) noexcept {
+    NV_IF_ELSE_TARGET(NV_IS_HOST,(
+        return __sharded_counter_host_slot() % __nodes;
+    ),(
+        unsigned const __threads = blockDim.x * blockDim.y * blockDim.z;
+        unsigned const __thread = threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+        unsigned const __block = blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z);
+        return (__block * __threads + __thread) % __nodes;
+    ))
+}
+
+// Queue nodes for the lock() overloads that take none. A thread claims the first free node
+// from its home node on, so threads rarely touch each other's entries; lock() waits for a node
+// to be returned if all are in use, and try_lock() fails.
+template<thread_scope _Sco, class _Node, size_t _Nodes>
+struct __queue_lock_pool {
+    static_assert(_Nodes > 0, "a queue lock pool needs at least one node");
+
+    struct alignas(64) __entry {
+        _Node __node;
+        atomic<int, _Sco> __in_use{0};
+    };
+    __entry __entries[_Nodes];
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    static bool __try_claim(__entry& __e) noexcept {
+        return __e.__in_use.load(memory_order_relaxed) == 0 &&
+               __e.__in_use.exchange(1, memory_order_acquire) == 0;
+    }
+
+    // Returns nullptr if every node is in use.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    __entry* __try_claim() noexcept {
+        size_t const __home = __queue_lock_home(_Nodes);
+        for (size_t __i = 0; __i < _Nodes; ++__i) {
+            __entry& __e = __entries[(__home + __i) % _Nodes];
+            if (__try_claim(__e))
+                return &__e;
+        }
+        return nullptr;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    __entry& __claim() {
+        __entry* __claimed = __try_claim();
+        if (__claimed == nullptr)
+            _CUDA_VSTD::__libcpp_thread_poll_with_backoff([&]() {
+                return (__claimed = __try_claim()) != nullptr;
+            });
+        return *__claimed;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __release(__entry& __e) noexcept {
+        __e.__in_use.store(0, memory_order_release);
+    }
+};
+
+// The Mellor-Crummey and Scott lock. A waiter links its node behind the tail and waits on the
+// node's own flag; the holder hands over by clearing its successor's flag. The overloads taking
+// a node let the caller supply it, typically from its stack on the host; device threads can
+// only share nodes in shared or global memory. The others take a node from a pool of
+// _PoolNodes nodes inside the lock.
+template<thread_scope _Sco, size_t _PoolNodes = 32>
+class mcs_lock
+{
+public:
+    struct alignas(64) node {
+        atomic<node*, _Sco> __next{nullptr};
+        atomic<int, _Sco> __locked{0};
+
+        node() = default;
+        node(node const&) = delete;
+        node& operator=(node const&) = delete;
+    };
+
+private:
+    using __pool_t = __queue_lock_pool<_Sco, node, _PoolNodes>;
+
+    atomic<node*, _Sco> __tail;
+    typename __pool_t::__entry* __holder;
+    __pool_t __pool;
+
+public:
+    _LIBCUDACXX_INLINE_VISIBILITY
+    mcs_lock() noexcept : __tail(nullptr), __holder(nullptr), __pool() { }
+    ~mcs_lock() = default;
+
+    mcs_lock(mcs_lock const&) = delete;
+    mcs_lock& operator=(mcs_lock const&) = delete;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void lock(node& __n)
+    {
+        __n.__next.store(nullptr, memory_order_relaxed);
+        __n.__locked.store(1, memory_order_relaxed);
+        node* const __pred = __tail.exchange(&__n, memory_order_acq_rel);
+        if (__pred == nullptr)
+            return;
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_mutex);
+        __pred->__next.store(&__n, memory_order_release);
+        while (__n.__locked.load(memory_order_acquire) != 0)
+            __n.__locked.wait(1, memory_order_relaxed);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_lock(node& __n) noexcept
+    {
+        __n.__next.store(nullptr, memory_order_relaxed);
+        node* __expected = nullptr;
+        return __tail.compare_exchange_strong(__expected, &__n, memory_order_acquire, memory_order_relaxed);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void unlock(node& __n) noexcept
+    {
+        node* __succ = __n.__next.load(memory_order_acquire);
+        if (__succ == nullptr) {
+            node* __expected = &__n;
+            if (__tail.compare_exchange_strong(__expected, nullptr, memory_order_release, memory_order_relaxed))
+                return;
+            // A successor has swapped itself in but not yet linked itself to this node.
+            _CUDA_VSTD::__libcpp_thread_poll_with_backoff([&]() {
+                return (__succ = __n.__next.load(memory_order_acquire)) != nullptr;
+            });
+        }
+        __succ->__locked.store(0, memory_order_release);
+        __succ->__locked.notify_one();
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void lock()
+    {
+        auto& __e = __pool.__claim();
+        lock(__e.__node);
+        __holder = &__e;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_lock() noexcept
+    {
+        auto* const __e = __pool.__try_claim();
+        if (__e == nullptr)
+            return false;
+        if (!try_lock(__e->__node)) {
+            __pool.__release(*__e);
+            return false;
+        }
+        __holder = __e;
+        return true;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void unlock() noexcept
+    {
+        auto& __e = *__holder;
+        unlock(__e.__node);
+        __pool.__release(__e);
+    }
+};
+
+// The Craig, Landin and Hagersten lock. A waiter swaps its node in as the tail and waits on the
+// flag of the node it replaced; unlocking clears the holder's own flag. A node stays in the
+// queue until its successor has been through the lock, so all nodes come from a pool of
+// _PoolNodes nodes inside the lock, plus the one that starts as the tail.
+template<thread_scope _Sco, size_t _PoolNodes = 32>
+class clh_lock
+{
+    struct __node {
+        atomic<int, _Sco> __locked{0};
+    };
+    using __pool_t = __queue_lock_pool<_Sco, __node, _PoolNodes + 1>;
+    using __entry = typename __pool_t::__entry;
+
+    atomic<__entry*, _Sco> __tail;
+    __entry* __holder;
+    __entry* __holder_pred;
+    __pool_t __pool;
+
+    // A node's flag is 1 while its owner holds or waits for the lock, and 0 once it has unlocked.
+    // A try_lock() that cannot leave the queue again stores __abandoned plus the pool index of its
+    // predecessor there instead, telling its successor to wait on that node.
+    static constexpr int __abandoned = 2;
+
+    // Returns the node the lock was finally handed over from, which is not __pred if abandoned
+    // nodes were skipped on the way. Nobody else looks at a skipped node, so it goes back to the pool.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    __entry* __wait(__entry* __pred)
+    {
+        int __state = __pred->__node.__locked.load(memory_order_acquire);
+        if (__state == 0)
+            return __pred;
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_mutex);
+        while (__state != 0) {
+            if (__state >= __abandoned) {
+                __entry* const __skipped = __pred;
+                __pred = &__pool.__entries[__state - __abandoned];
+                __pool.__release(*__skipped);
+            }
+            else
+                __pred->__node.__locked.wait(1, memory_order_relaxed);
+            __state = __pred->__node.__locked.load(memory_order_acquire);
+        }
+        return __pred;
+    }
+
+public:
+    _LIBCUDACXX_INLINE_VISIBILITY
+    clh_lock() noexcept : __tail(nullptr), __holder(nullptr), __holder_pred(nullptr), __pool()
+    {
+        __pool.__entries[_PoolNodes].__in_use.store(1, memory_order_relaxed);
+        __tail.store(&__pool.__entries[_PoolNodes], memory_order_relaxed);
+    }
+    ~clh_lock() = default;
+
+    clh_lock(clh_lock const&) = delete;
+    clh_lock& operator=(clh_lock const&) = delete;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void lock()
+    {
+        __entry& __e = __pool.__claim();
+        __e.__node.__locked.store(1, memory_order_relaxed);
+        __entry* const __pred = __tail.exchange(&__e, memory_order_acq_rel);
+        __holder_pred = __wait(__pred);
+        __holder = &__e;
+    }
+
+    // A tail whose flag is clear belongs to a holder that has left, so swapping in behind it
+    // takes the lock at once. Should the tail's node have been recycled and queued again in the
+    // meantime, this thread finds itself queued behind a live node. It then takes its node back
+    // out of the queue if nobody has queued behind it yet, and abandons it otherwise; either
+    // way it fails without waiting.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_lock()
+    {
+        __entry* __pred = __tail.load(memory_order_acquire);
+        if (__pred->__node.__locked.load(memory_order_acquire) != 0)
+            return false;
+        __entry* const __e = __pool.__try_claim();
+        if (__e == nullptr)
+            return false;
+        __e->__node.__locked.store(1, memory_order_relaxed);
+        if (!__tail.compare_exchange_strong(__pred, __e, memory_order_acq_rel, memory_order_relaxed)) {
+            __pool.__release(*__e);
+            return false;
+        }
+        if (__pred->__node.__locked.load(memory_order_acquire) == 0) {
+            __holder = __e;
+            __holder_pred = __pred;
+            return true;
+        }
+        __entry* __expected = __e;
+        if (__tail.compare_exchange_strong(__expected, __pred, memory_order_acq_rel, memory_order_relaxed)) {
+            __pool.__release(*__e);
+        }
+        else {
+            __e->__node.__locked.store(__abandoned + static_cast<int>(__pred - __pool.__entries), memory_order_release);
+            __e->__node.__locked.notify_one();
+        }
+        return false;
+    }
+
+    // Nobody looks at the predecessor's node once its successor holds the lock, so it goes back
+    // to the pool; the holder's node stays in the queue for the next waiter to watch.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void unlock() noexcept
+    {
+        __entry* const __e = __holder;
+        __pool.__release(*__holder_pred);
+        __e->__node.__locked.store(0, memory_order_release);
+        __e->__node.__locked.notify_one();
+    }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_MUTEX_H
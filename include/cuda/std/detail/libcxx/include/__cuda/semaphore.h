@@ -21,13 +21,31 @@
 
 _LIBCUDACXX_BEGIN_NAMESPACE_CUDA
 
-template<thread_scope _Sco, ptrdiff_t __least_max_value = INT_MAX>
-class counting_semaphore : public _CUDA_VSTD::__semaphore_base<__least_max_value, _Sco>
+// Acquisition orders for cuda::counting_semaphore. Each names the base that implements it as
+// __base<_Sco, __least_max_value>.
+
+// Any acquirer may take a free unit, even ahead of threads that are already waiting.
+struct semaphore_barging {
+    template<thread_scope _Sco, ptrdiff_t __least_max_value>
+    using __base = _CUDA_VSTD::__semaphore_base<__least_max_value, _Sco>;
+};
+
+// Acquirers are served in arrival order, each waiting on one of _Slots wait slots.
+template<ptrdiff_t _Slots = 32>
+struct semaphore_fifo {
+    template<thread_scope _Sco, ptrdiff_t __least_max_value>
+    using __base = _CUDA_VSTD::__fifo_semaphore_base<_Sco, __least_max_value, _Slots>;
+};
+
+template<thread_scope _Sco, ptrdiff_t __least_max_value = INT_MAX, class _Algorithm = semaphore_barging>
+class counting_semaphore : public _Algorithm::template __base<_Sco, __least_max_value>
 {
-    static_assert(__least_max_value <= _CUDA_VSTD::__semaphore_base<__least_max_value, _Sco>::max(), "");
+    using __algorithm_base = typename _Algorithm::template __base<_Sco, __least_max_value>;
+
+    static_assert(__least_max_value <= __algorithm_base::max(), "");
 public:
     _LIBCUDACXX_INLINE_VISIBILITY _LIBCUDACXX_CONSTEXPR
-    counting_semaphore(ptrdiff_t __count = 0) : _CUDA_VSTD::__semaphore_base<__least_max_value, _Sco>(__count) { }
+    counting_semaphore(ptrdiff_t __count = 0) : __algorithm_base(__count) { }
     ~counting_semaphore() = default;
 
     counting_semaphore(const counting_semaphore&) = delete;
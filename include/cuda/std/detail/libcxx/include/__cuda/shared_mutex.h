@@ -0,0 +1,191 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_SHARED_MUTEX_H
+#define _LIBCUDACXX___CUDA_SHARED_MUTEX_H
+
+#ifndef __cuda_std__
+#error "<__cuda/shared_mutex> should only be included in from <cuda/std/shared_mutex>"
+#endif // __cuda_std__
+
+#if defined(_LIBCUDACXX_USE_PRAGMA_GCC_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+template<thread_scope _Sco>
+struct alignas(128) __shared_mutex_reader_slot {
+    _CUDA_VSTD::__atomic_base<int, _Sco> __count;
+
+    _LIBCUDACXX_INLINE_VISIBILITY _LIBCUDACXX_CONSTEXPR
+    __shared_mutex_reader_slot() noexcept : __count(0) { }
+};
+
+// A reader-writer lock whose readers count themselves into one of _Slots cache-line-sized slots,
+// picked by host thread or device warp as for sharded_counter, so readers on different slots
+// never write the same line. A writer takes the writer mutex, raises __writer_present, and waits
+// for every slot to drain; a reader that finds __writer_present raised backs out of its slot and
+// waits for it to fall. The increment and the check on each side are sequentially consistent,
+// so either the reader sees the writer or the writer sees the reader.
+template<thread_scope _Sco, size_t _Slots>
+class __distributed_shared_mutex_base
+{
+    static_assert(_Slots > 0, "a distributed shared_mutex needs at least one reader slot");
+
+    // __writer_present is 0 with no writer, 1 with one, and 2 with one that readers wait behind.
+    _CUDA_VSTD::__atomic_mutex_base<_Sco>       __writers;
+    _CUDA_VSTD::__atomic_base<int, _Sco>        __writer_present;
+    __shared_mutex_reader_slot<_Sco>            __slots[_Slots];
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    _CUDA_VSTD::__atomic_base<int, _Sco>& __local_slot() noexcept
+    {
+        return __slots[__local_shard(_Slots)].__count;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __leave(_CUDA_VSTD::__atomic_base<int, _Sco>& __count) noexcept
+    {
+        if (__count.fetch_sub(1, memory_order_seq_cst) == 1 &&
+            __writer_present.load(memory_order_seq_cst) != 0)
+            __count.notify_all();
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool __try_enter(_CUDA_VSTD::__atomic_base<int, _Sco>& __count) noexcept
+    {
+        __count.fetch_add(1, memory_order_seq_cst);
+        if (__writer_present.load(memory_order_seq_cst) == 0)
+            return true;
+        __leave(__count);
+        return false;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __wait_for_writer()
+    {
+        int __old = __writer_present.load(memory_order_relaxed);
+        while (__old != 0) {
+            if (__old == 1 && !__writer_present.compare_exchange_weak(__old, 2, memory_order_relaxed, memory_order_relaxed))
+                continue;
+            __writer_present.wait(2, memory_order_relaxed);
+            __old = __writer_present.load(memory_order_relaxed);
+        }
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void __release_readers() noexcept
+    {
+        if (__writer_present.exchange(0, memory_order_release) == 2)
+            __writer_present.notify_all();
+    }
+
+public:
+    _LIBCUDACXX_INLINE_VISIBILITY _LIBCUDACXX_CONSTEXPR
+    __distributed_shared_mutex_base() noexcept : __writers(), __writer_present(0), __slots() { }
+
+    ~__distributed_shared_mutex_base() = default;
+
+    __distributed_shared_mutex_base(__distributed_shared_mutex_base const&) = delete;
+    __distributed_shared_mutex_base& operator=(__distributed_shared_mutex_base const&) = delete;
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void lock()
+    {
+        __writers.lock();
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_mutex);
+        __writer_present.store(1, memory_order_seq_cst);
+        for (size_t __i = 0; __i < _Slots; ++__i) {
+            auto& __count = __slots[__i].__count;
+            for (int __old = __count.load(memory_order_seq_cst); __old != 0; __old = __count.load(memory_order_seq_cst))
+                __count.wait(__old, memory_order_relaxed);
+        }
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_lock() noexcept
+    {
+        if (!__writers.try_lock())
+            return false;
+        __writer_present.store(1, memory_order_seq_cst);
+        for (size_t __i = 0; __i < _Slots; ++__i) {
+            if (__slots[__i].__count.load(memory_order_seq_cst) != 0) {
+                unlock();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void unlock() noexcept
+    {
+        __release_readers();
+        __writers.unlock();
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void lock_shared()
+    {
+        auto& __count = __local_slot();
+        if (__try_enter(__count))
+            return;
+        _CUDA_VSTD::__libcpp_wait_stats_site const __stats(_CUDA_VSTD::__libcpp_wait_site_mutex);
+        do {
+            __wait_for_writer();
+        } while (!__try_enter(__count));
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    bool try_lock_shared() noexcept
+    {
+        return __try_enter(__local_slot());
+    }
+
+    // Must run on the thread, or in the warp, that locked.
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void unlock_shared() noexcept
+    {
+        __leave(__local_slot());
+    }
+};
+
+// Reader-writer algorithms for cuda::shared_mutex. Each names the base that implements it as
+// __base<_Sco>.
+
+// Readers count themselves into _Slots padded slots; reads scale, at _Slots cache lines per lock.
+template<size_t _Slots = 32>
+struct shared_mutex_distributed {
+    template<thread_scope _Sco>
+    using __base = __distributed_shared_mutex_base<_Sco, _Slots>;
+};
+
+// Readers and writers share a single 4-byte word.
+struct shared_mutex_compact {
+    template<thread_scope _Sco>
+    using __base = _CUDA_VSTD::__compact_shared_mutex_base<_Sco>;
+};
+
+template<thread_scope _Sco, class _Algorithm = shared_mutex_distributed<>>
+class shared_mutex : public _Algorithm::template __base<_Sco>
+{
+public:
+    _LIBCUDACXX_INLINE_VISIBILITY _LIBCUDACXX_CONSTEXPR
+    shared_mutex() noexcept = default;
+    ~shared_mutex() = default;
+
+    shared_mutex(const shared_mutex&) = delete;
+    shared_mutex& operator=(const shared_mutex&) = delete;
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_SHARED_MUTEX_H
@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_SYNC_STORAGE_H
+#define _LIBCUDACXX___CUDA_SYNC_STORAGE_H
+
+#ifndef __cuda_std__
+#error "<__cuda/sync_storage.h> should only be included in from <cuda/std/barrier> or <cuda/std/latch>"
+#endif // __cuda_std__
+
+#if defined(_LIBCUDACXX_USE_PRAGMA_GCC_SYSTEM_HEADER)
+#pragma GCC system_header
+#endif
+
+// Storage policies hand a synchronization algorithm its array of nodes. _Algorithm names the
+// node type, __node_t, and how many nodes a given participant count needs, __nodes(count).
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// Node storage for the cuda::barrier and cuda::latch algorithms that need more than one counter:
+// room for up to _MaxExpected participants inside the object itself.
+template<_CUDA_VSTD::ptrdiff_t _MaxExpected>
+struct barrier_inline_storage {
+    static_assert(_MaxExpected >= 0, "cuda::barrier_inline_storage requires a non-negative capacity");
+
+    template<class _Algorithm>
+    class __holder {
+        using _Node = typename _Algorithm::__node_t;
+
+        _Node __nodes[_Algorithm::__nodes(_MaxExpected)];
+
+    public:
+        // Checked in every build: an object expecting more participants than _MaxExpected
+        // would otherwise run its algorithm past the end of __nodes.
+        _LIBCUDACXX_INLINE_VISIBILITY
+        _Node * __allocate(_CUDA_VSTD::ptrdiff_t __count) {
+            if (__count > _Algorithm::__nodes(_MaxExpected)) {
+                NV_IF_ELSE_TARGET(NV_IS_HOST, (
+                    _CUDA_VSTD::abort();
+                ), (
+                    __trap();
+                ))
+            }
+            return __nodes;
+        }
+        _LIBCUDACXX_INLINE_VISIBILITY
+        void __deallocate(_Node *, _CUDA_VSTD::ptrdiff_t) {}
+
+        _LIBCUDACXX_INLINE_VISIBILITY
+        static constexpr _CUDA_VSTD::ptrdiff_t __max_expected() { return _MaxExpected; }
+    };
+};
+
+// Node storage taken from a memory resource passed to the barrier's constructor, such as a
+// cuda::mr::resource_ref. Any _Resource providing allocate(bytes, alignment) and
+// deallocate(ptr, bytes, alignment) will do.
+template<class _Resource>
+struct barrier_resource_storage {
+    template<class _Algorithm>
+    class __holder {
+        using _Node = typename _Algorithm::__node_t;
+
+        _Resource __resource;
+
+    public:
+        _LIBCUDACXX_INLINE_VISIBILITY
+        explicit __holder(_Resource __r) : __resource(__r) {}
+
+        _LIBCUDACXX_INLINE_VISIBILITY
+        _Node * __allocate(_CUDA_VSTD::ptrdiff_t __count) {
+            _Node * const __nodes = static_cast<_Node *>(__resource.allocate(__count * sizeof(_Node), alignof(_Node)));
+            for (_CUDA_VSTD::ptrdiff_t __i = 0; __i < __count; ++__i) {
+                ::new (static_cast<void *>(__nodes + __i)) _Node();
+            }
+            return __nodes;
+        }
+        _LIBCUDACXX_INLINE_VISIBILITY
+        void __deallocate(_Node * __nodes, _CUDA_VSTD::ptrdiff_t __count) {
+            __resource.deallocate(__nodes, __count * sizeof(_Node), alignof(_Node));
+        }
+
+        _LIBCUDACXX_INLINE_VISIBILITY
+        static constexpr _CUDA_VSTD::ptrdiff_t __max_expected() { return _CUDA_VSTD::numeric_limits<_CUDA_VSTD::ptrdiff_t>::max(); }
+    };
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_SYNC_STORAGE_H
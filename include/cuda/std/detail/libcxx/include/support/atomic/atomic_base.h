@@ -16,7 +16,7 @@
 
 // Guard ifdef for lock free query in case it is assigned elsewhere (MSVC/CUDA)
 #ifndef _LIBCUDACXX_ATOMIC_IS_LOCK_FREE
-#define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(__x) __atomic_is_lock_free(__x, 0)
+#define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(__x) (_LIBCUDACXX_ATOMIC_IS_WIDE_LOCK_FREE(__x) || __atomic_is_lock_free(__x, 0))
 #endif
 
 _LIBCUDACXX_INLINE_VISIBILITY inline _LIBCUDACXX_CONSTEXPR int __cxx_atomic_order_to_int(memory_order __order) {
@@ -39,6 +39,137 @@ _LIBCUDACXX_INLINE_VISIBILITY inline _LIBCUDACXX_CONSTEXPR int __cxx_atomic_fail
               __ATOMIC_CONSUME))));
 }
 
+#ifndef _LIBCUDACXX_HAS_NO_HOST_ATOMIC_16
+
+// GCC and Clang lower 16-byte __atomic builtins to libatomic calls, which may
+// take a lock. These issue the double-width compare-and-swap inline instead;
+// every operation on a 16-byte object is built from it.
+inline bool __cxx_atomic_cas_16(void const volatile* __ptr, void* __expected, void const* __desired) {
+  typedef unsigned long long __word_t;
+  volatile unsigned __int128* __obj = const_cast<volatile unsigned __int128*>(
+    static_cast<const volatile unsigned __int128*>(__ptr));
+  __word_t __e[2], __d[2];
+  __builtin_memcpy(__e, __expected, sizeof(__e));
+  __builtin_memcpy(__d, __desired, sizeof(__d));
+  bool __ret;
+#if defined(__x86_64__)
+  __asm__ __volatile__("lock cmpxchg16b %1\n\t"
+                       "sete %0"
+                       : "=q"(__ret), "+m"(*__obj), "+a"(__e[0]), "+d"(__e[1])
+                       : "b"(__d[0]), "c"(__d[1])
+                       : "memory", "cc");
+#elif defined(__ARM_FEATURE_ATOMICS)
+  register __word_t __x0 __asm__("x0") = __e[0];
+  register __word_t __x1 __asm__("x1") = __e[1];
+  register __word_t __x2 __asm__("x2") = __d[0];
+  register __word_t __x3 __asm__("x3") = __d[1];
+  __asm__ __volatile__("caspal %0, %1, %3, %4, %2"
+                       : "+r"(__x0), "+r"(__x1), "+Q"(*__obj)
+                       : "r"(__x2), "r"(__x3)
+                       : "memory");
+  __ret = __x0 == __e[0] && __x1 == __e[1];
+  __e[0] = __x0;
+  __e[1] = __x1;
+#else
+  // Without LSE, the observed value is only single-copy atomic once the
+  // exclusive pair store succeeds, so a failed comparison writes it back.
+  __word_t __lo, __hi;
+  unsigned __status;
+  __asm__ __volatile__("0: ldaxp %0, %1, %3\n\t"
+                       "cmp %0, %4\n\t"
+                       "ccmp %1, %5, #0, eq\n\t"
+                       "b.ne 1f\n\t"
+                       "stlxp %w2, %6, %7, %3\n\t"
+                       "cbnz %w2, 0b\n\t"
+                       "b 2f\n"
+                       "1: stlxp %w2, %0, %1, %3\n\t"
+                       "cbnz %w2, 0b\n"
+                       "2:"
+                       : "=&r"(__lo), "=&r"(__hi), "=&r"(__status), "+Q"(*__obj)
+                       : "r"(__e[0]), "r"(__e[1]), "r"(__d[0]), "r"(__d[1])
+                       : "memory", "cc");
+  __ret = __lo == __e[0] && __hi == __e[1];
+  __e[0] = __lo;
+  __e[1] = __hi;
+#endif
+  __builtin_memcpy(__expected, __e, sizeof(__e));
+  return __ret;
+}
+
+template <typename _Tp>
+using __cxx_atomic_is_wide = integral_constant<bool, sizeof(_Tp) == 16>;
+
+#else
+
+template <typename _Tp>
+using __cxx_atomic_is_wide = false_type;
+
+#endif // _LIBCUDACXX_HAS_NO_HOST_ATOMIC_16
+
+template <typename _Tp, typename _Up>
+inline void __cxx_atomic_store_n(_Tp* __a, _Up* __val, int __order, false_type) {
+  __atomic_store(__a, __val, __order);
+}
+
+template <typename _Tp, typename _Up>
+inline void __cxx_atomic_load_n(_Tp* __a, _Up* __ret, int __order, false_type) {
+  __atomic_load(__a, __ret, __order);
+}
+
+template <typename _Tp, typename _Up>
+inline void __cxx_atomic_exchange_n(_Tp* __a, _Up* __val, _Up* __ret, int __order, false_type) {
+  __atomic_exchange(__a, __val, __ret, __order);
+}
+
+template <typename _Tp, typename _Up>
+inline bool __cxx_atomic_compare_exchange_n(_Tp* __a, _Up* __expected, _Up* __value, bool __weak,
+                                            int __success, int __failure, false_type) {
+  return __atomic_compare_exchange(__a, __expected, __value, __weak, __success, __failure);
+}
+
+#ifndef _LIBCUDACXX_HAS_NO_HOST_ATOMIC_16
+
+// The locked compare-and-swap is a full barrier on x86-64, and CASPAL or an
+// LDAXP/STLXP pair is at least as strong as any order on AArch64.
+template <typename _Tp, typename _Up>
+inline void __cxx_atomic_store_n(_Tp* __a, _Up* __val, int, true_type) {
+  unsigned __int128 __old = 0;
+  while (!__cxx_atomic_cas_16(__a, &__old, __val))
+    ;
+}
+
+// Processors with AVX make aligned 16-byte VMOVDQA loads single-copy atomic,
+// and a load is acquire on x86-64. Elsewhere a load is a compare-and-swap of
+// the value with itself, which needs the object to be writable.
+template <typename _Tp, typename _Up>
+inline void __cxx_atomic_load_n(_Tp* __a, _Up* __ret, int, true_type) {
+#if defined(__x86_64__) && defined(__AVX__)
+  typedef long long __vector_t __attribute__((__vector_size__(16)));
+  __vector_t __v;
+  __asm__ __volatile__("vmovdqa %1, %0"
+                       : "=x"(__v)
+                       : "m"(*static_cast<const volatile __vector_t*>(static_cast<const volatile void*>(__a)))
+                       : "memory");
+  __builtin_memcpy(__ret, &__v, sizeof(__v));
+#else
+  __cxx_atomic_cas_16(__a, __ret, __ret);
+#endif
+}
+
+template <typename _Tp, typename _Up>
+inline void __cxx_atomic_exchange_n(_Tp* __a, _Up* __val, _Up* __ret, int, true_type) {
+  while (!__cxx_atomic_cas_16(__a, __ret, __val))
+    ;
+}
+
+template <typename _Tp, typename _Up>
+inline bool __cxx_atomic_compare_exchange_n(_Tp* __a, _Up* __expected, _Up* __value, bool,
+                                            int, int, true_type) {
+  return __cxx_atomic_cas_16(__a, __expected, __value);
+}
+
+#endif // _LIBCUDACXX_HAS_NO_HOST_ATOMIC_16
+
 template <typename _Tp, typename _Up>
 inline void __cxx_atomic_init(volatile _Tp* __a,  _Up __val) {
   auto __a_tmp = __cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a));
@@ -65,14 +196,16 @@ template <typename _Tp, typename _Up>
 inline void __cxx_atomic_store(_Tp* __a,  _Up __val,
                         memory_order __order) {
   auto __v_temp = __cxx_atomic_wrap_to_base(__a, __val);
-  __atomic_store(__cxx_atomic_unwrap(__a), &__v_temp, __cxx_atomic_order_to_int(__order));
+  __cxx_atomic_store_n(__cxx_atomic_unwrap(__a), &__v_temp, __cxx_atomic_order_to_int(__order),
+                       __cxx_atomic_is_wide<__cxx_atomic_underlying_t<_Tp>>());
 }
 
 template <typename _Tp>
 inline auto __cxx_atomic_load(const _Tp* __a,
                        memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   auto __ret = __cxx_atomic_base_temporary(__a);
-  __atomic_load(__cxx_atomic_unwrap(__a), &__ret, __cxx_atomic_order_to_int(__order));
+  __cxx_atomic_load_n(__cxx_atomic_unwrap(__a), &__ret, __cxx_atomic_order_to_int(__order),
+                      __cxx_atomic_is_wide<__cxx_atomic_underlying_t<_Tp>>());
   return *__cxx_get_underlying_atomic(&__ret);
 }
 
@@ -81,7 +214,8 @@ inline auto __cxx_atomic_exchange(_Tp* __a, _Up __val,
                           memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   auto __v_temp = __cxx_atomic_wrap_to_base(__a, __val);
   auto __ret = __cxx_atomic_base_temporary(__a);
-  __atomic_exchange(__cxx_atomic_unwrap(__a), &__v_temp, &__ret, __cxx_atomic_order_to_int(__order));
+  __cxx_atomic_exchange_n(__cxx_atomic_unwrap(__a), &__v_temp, &__ret, __cxx_atomic_order_to_int(__order),
+                          __cxx_atomic_is_wide<__cxx_atomic_underlying_t<_Tp>>());
   return *__cxx_get_underlying_atomic(&__ret);
 }
 
@@ -90,10 +224,11 @@ inline bool __cxx_atomic_compare_exchange_strong(
     _Tp* __a, _Up* __expected, _Up __value, memory_order __success,
     memory_order __failure) {
   (void)__expected;
-  return __atomic_compare_exchange(__cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a)),
-                                   __expected, &__value, false,
-                                   __cxx_atomic_order_to_int(__success),
-                                   __cxx_atomic_failure_order_to_int(__failure));
+  return __cxx_atomic_compare_exchange_n(__cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a)),
+                                         __expected, &__value, false,
+                                         __cxx_atomic_order_to_int(__success),
+                                         __cxx_atomic_failure_order_to_int(__failure),
+                                         __cxx_atomic_is_wide<_Up>());
 }
 
 template <typename _Tp, typename _Up>
@@ -101,10 +236,11 @@ inline bool __cxx_atomic_compare_exchange_weak(
     _Tp* __a, _Up* __expected, _Up __value, memory_order __success,
     memory_order __failure) {
   (void)__expected;
-  return __atomic_compare_exchange(__cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a)),
-                                   __expected, &__value, true,
-                                   __cxx_atomic_order_to_int(__success),
-                                   __cxx_atomic_failure_order_to_int(__failure));
+  return __cxx_atomic_compare_exchange_n(__cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a)),
+                                         __expected, &__value, true,
+                                         __cxx_atomic_order_to_int(__success),
+                                         __cxx_atomic_failure_order_to_int(__failure),
+                                         __cxx_atomic_is_wide<_Up>());
 }
 
 template <typename _Tp>
@@ -120,7 +256,15 @@ struct __atomic_ptr_inc<_Tp[]> { };
 template <typename _Tp, int n>
 struct __atomic_ptr_inc<_Tp[n]> { };
 
-template <typename _Tp, typename _Td, __enable_if_t<!is_floating_point<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
+// Floating point and 16-byte arithmetic have no fetch instruction and are
+// built from compare-and-swap. The weak form lets an LL/SC host retry from
+// the outer loop, and a failed attempt already returns the value to retry
+// with, so the object is read once per attempt.
+template <typename _Tp>
+using __cxx_atomic_uses_cas_loop = integral_constant<bool,
+  is_floating_point<_Tp>::value || __cxx_atomic_is_wide<_Tp>::value>;
+
+template <typename _Tp, typename _Td, __enable_if_t<!__cxx_atomic_uses_cas_loop<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
 inline auto __cxx_atomic_fetch_add(_Tp* __a, _Td __delta,
                            memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   constexpr auto __skip_v = __atomic_ptr_inc<__cxx_atomic_underlying_t<_Tp>>::value;
@@ -129,20 +273,20 @@ inline auto __cxx_atomic_fetch_add(_Tp* __a, _Td __delta,
                             __cxx_atomic_order_to_int(__order));
 }
 
-template <typename _Tp, typename _Td, __enable_if_t<is_floating_point<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
+template <typename _Tp, typename _Td, __enable_if_t<__cxx_atomic_uses_cas_loop<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
 inline auto __cxx_atomic_fetch_add(_Tp* __a, _Td __delta,
                            memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   auto __expected = __cxx_atomic_load(__a, memory_order_relaxed);
   auto __desired = __expected + __delta;
 
-  while(!__cxx_atomic_compare_exchange_strong(__a, &__expected, __desired, __order, __order)) {
+  while(!__cxx_atomic_compare_exchange_weak(__a, &__expected, __desired, __order, memory_order_relaxed)) {
       __desired = __expected + __delta;
   }
 
   return __expected;
 }
 
-template <typename _Tp, typename _Td, __enable_if_t<!is_floating_point<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
+template <typename _Tp, typename _Td, __enable_if_t<!__cxx_atomic_uses_cas_loop<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
 inline auto __cxx_atomic_fetch_sub(_Tp* __a, _Td __delta,
                            memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   constexpr auto __skip_v = __atomic_ptr_inc<__cxx_atomic_underlying_t<_Tp>>::value;
@@ -151,20 +295,20 @@ inline auto __cxx_atomic_fetch_sub(_Tp* __a, _Td __delta,
                             __cxx_atomic_order_to_int(__order));
 }
 
-template <typename _Tp, typename _Td, __enable_if_t<is_floating_point<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
+template <typename _Tp, typename _Td, __enable_if_t<__cxx_atomic_uses_cas_loop<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
 inline auto __cxx_atomic_fetch_sub(_Tp* __a, _Td __delta,
                            memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   auto __expected = __cxx_atomic_load(__a, memory_order_relaxed);
   auto __desired = __expected - __delta;
 
-  while(!__cxx_atomic_compare_exchange_strong(__a, &__expected, __desired, __order, __order)) {
+  while(!__cxx_atomic_compare_exchange_weak(__a, &__expected, __desired, __order, memory_order_relaxed)) {
       __desired = __expected - __delta;
   }
 
   return __expected;
 }
 
-template <typename _Tp, typename _Td>
+template <typename _Tp, typename _Td, __enable_if_t<!__cxx_atomic_is_wide<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
 inline auto __cxx_atomic_fetch_and(_Tp* __a, _Td __pattern,
                             memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   auto __a_tmp = __cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a));
@@ -172,7 +316,20 @@ inline auto __cxx_atomic_fetch_and(_Tp* __a, _Td __pattern,
                             __cxx_atomic_order_to_int(__order));
 }
 
-template <typename _Tp, typename _Td>
+template <typename _Tp, typename _Td, __enable_if_t<__cxx_atomic_is_wide<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
+inline auto __cxx_atomic_fetch_and(_Tp* __a, _Td __pattern,
+                           memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
+  auto __expected = __cxx_atomic_load(__a, memory_order_relaxed);
+  auto __desired = __expected & __pattern;
+
+  while(!__cxx_atomic_compare_exchange_strong(__a, &__expected, __desired, __order, __order)) {
+      __desired = __expected & __pattern;
+  }
+
+  return __expected;
+}
+
+template <typename _Tp, typename _Td, __enable_if_t<!__cxx_atomic_is_wide<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
 inline auto __cxx_atomic_fetch_or(_Tp* __a, _Td __pattern,
                           memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   auto __a_tmp = __cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a));
@@ -180,7 +337,20 @@ inline auto __cxx_atomic_fetch_or(_Tp* __a, _Td __pattern,
                            __cxx_atomic_order_to_int(__order));
 }
 
-template <typename _Tp, typename _Td>
+template <typename _Tp, typename _Td, __enable_if_t<__cxx_atomic_is_wide<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
+inline auto __cxx_atomic_fetch_or(_Tp* __a, _Td __pattern,
+                           memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
+  auto __expected = __cxx_atomic_load(__a, memory_order_relaxed);
+  auto __desired = __expected | __pattern;
+
+  while(!__cxx_atomic_compare_exchange_strong(__a, &__expected, __desired, __order, __order)) {
+      __desired = __expected | __pattern;
+  }
+
+  return __expected;
+}
+
+template <typename _Tp, typename _Td, __enable_if_t<!__cxx_atomic_is_wide<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
 inline auto __cxx_atomic_fetch_xor(_Tp* __a, _Td __pattern,
                            memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   auto __a_tmp = __cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a));
@@ -188,32 +358,144 @@ inline auto __cxx_atomic_fetch_xor(_Tp* __a, _Td __pattern,
                             __cxx_atomic_order_to_int(__order));
 }
 
-template <typename _Tp, typename _Td>
-inline auto __cxx_atomic_fetch_max(_Tp* __a, _Td __val,
+template <typename _Tp, typename _Td, __enable_if_t<__cxx_atomic_is_wide<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
+inline auto __cxx_atomic_fetch_xor(_Tp* __a, _Td __pattern,
                            memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
   auto __expected = __cxx_atomic_load(__a, memory_order_relaxed);
-  auto __desired = __expected > __val ? __expected : __val;
+  auto __desired = __expected ^ __pattern;
 
-  while(__desired == __val &&
-          !__cxx_atomic_compare_exchange_strong(__a, &__expected, __desired, __order, __order)) {
-      __desired = __expected > __val ? __expected : __val;
+  while(!__cxx_atomic_compare_exchange_strong(__a, &__expected, __desired, __order, __order)) {
+      __desired = __expected ^ __pattern;
   }
 
   return __expected;
 }
 
+// An early exit from fetch_max and fetch_min, when the object already holds
+// the result, reads it with the order a failed compare-and-swap would use.
+inline _LIBCUDACXX_CONSTEXPR memory_order __cxx_atomic_load_order(memory_order __order) {
+  return __order == memory_order_release ? memory_order_relaxed :
+         (__order == memory_order_acq_rel ? memory_order_acquire : __order);
+}
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_ATOMICS)
+
+// LSE has single-instruction signed and unsigned max and min. The order picks
+// the acquire and release suffixes and the size the width suffix.
+#define _LIBCUDACXX_ATOMIC_LSE_FETCH_OP(_Name, _Insn, _Type, _Width, _Reg)                      \
+inline _Type _Name(_Type volatile* __ptr, _Type __val, int __order) {                           \
+  _Type __old;                                                                                  \
+  if (__order == __ATOMIC_RELAXED)                                                              \
+    __asm__ __volatile__(_Insn _Width " %" _Reg "2, %" _Reg "0, %1"                             \
+                         : "=r"(__old), "+Q"(*__ptr) : "r"(__val) : "memory");                  \
+  else if (__order == __ATOMIC_ACQUIRE || __order == __ATOMIC_CONSUME)                          \
+    __asm__ __volatile__(_Insn "a" _Width " %" _Reg "2, %" _Reg "0, %1"                         \
+                         : "=r"(__old), "+Q"(*__ptr) : "r"(__val) : "memory");                  \
+  else if (__order == __ATOMIC_RELEASE)                                                         \
+    __asm__ __volatile__(_Insn "l" _Width " %" _Reg "2, %" _Reg "0, %1"                         \
+                         : "=r"(__old), "+Q"(*__ptr) : "r"(__val) : "memory");                  \
+  else                                                                                          \
+    __asm__ __volatile__(_Insn "al" _Width " %" _Reg "2, %" _Reg "0, %1"                        \
+                         : "=r"(__old), "+Q"(*__ptr) : "r"(__val) : "memory");                  \
+  return __old;                                                                                 \
+}
+
+#define _LIBCUDACXX_ATOMIC_LSE_MINMAX(_Type, _UType, _Width, _Reg)                              \
+_LIBCUDACXX_ATOMIC_LSE_FETCH_OP(__cxx_atomic_lse_fetch_max, "ldsmax", _Type, _Width, _Reg)      \
+_LIBCUDACXX_ATOMIC_LSE_FETCH_OP(__cxx_atomic_lse_fetch_min, "ldsmin", _Type, _Width, _Reg)      \
+_LIBCUDACXX_ATOMIC_LSE_FETCH_OP(__cxx_atomic_lse_fetch_max, "ldumax", _UType, _Width, _Reg)     \
+_LIBCUDACXX_ATOMIC_LSE_FETCH_OP(__cxx_atomic_lse_fetch_min, "ldumin", _UType, _Width, _Reg)
+
+_LIBCUDACXX_ATOMIC_LSE_MINMAX(__INT8_TYPE__, __UINT8_TYPE__, "b", "w")
+_LIBCUDACXX_ATOMIC_LSE_MINMAX(__INT16_TYPE__, __UINT16_TYPE__, "h", "w")
+_LIBCUDACXX_ATOMIC_LSE_MINMAX(__INT32_TYPE__, __UINT32_TYPE__, "", "w")
+_LIBCUDACXX_ATOMIC_LSE_MINMAX(__INT64_TYPE__, __UINT64_TYPE__, "", "x")
+
+#undef _LIBCUDACXX_ATOMIC_LSE_MINMAX
+#undef _LIBCUDACXX_ATOMIC_LSE_FETCH_OP
+
+template <typename _Tp>
+using __cxx_atomic_has_lse_minmax = integral_constant<bool,
+  is_integral<_Tp>::value && !is_same<_Tp, bool>::value &&
+  (sizeof(_Tp) == 1 || sizeof(_Tp) == 2 || sizeof(_Tp) == 4 || sizeof(_Tp) == 8)>;
+
+// The fixed-width type with the size and signedness of _Tp.
+template <typename _Tp, size_t _Size = sizeof(_Tp), bool _Signed = is_signed<_Tp>::value>
+struct __cxx_atomic_lse_type;
+template <typename _Tp> struct __cxx_atomic_lse_type<_Tp, 1, true>  { typedef __INT8_TYPE__ type; };
+template <typename _Tp> struct __cxx_atomic_lse_type<_Tp, 1, false> { typedef __UINT8_TYPE__ type; };
+template <typename _Tp> struct __cxx_atomic_lse_type<_Tp, 2, true>  { typedef __INT16_TYPE__ type; };
+template <typename _Tp> struct __cxx_atomic_lse_type<_Tp, 2, false> { typedef __UINT16_TYPE__ type; };
+template <typename _Tp> struct __cxx_atomic_lse_type<_Tp, 4, true>  { typedef __INT32_TYPE__ type; };
+template <typename _Tp> struct __cxx_atomic_lse_type<_Tp, 4, false> { typedef __UINT32_TYPE__ type; };
+template <typename _Tp> struct __cxx_atomic_lse_type<_Tp, 8, true>  { typedef __INT64_TYPE__ type; };
+template <typename _Tp> struct __cxx_atomic_lse_type<_Tp, 8, false> { typedef __UINT64_TYPE__ type; };
+
 template <typename _Tp, typename _Td>
-inline auto __cxx_atomic_fetch_min(_Tp* __a, _Td __val,
-                           memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
-  auto __expected = __cxx_atomic_load(__a, memory_order_relaxed);
-  auto __desired = __expected < __val ? __expected : __val;
+inline auto __cxx_atomic_fetch_max_n(_Tp* __a, _Td __val, __cxx_atomic_underlying_t<_Tp>, memory_order __order, true_type)
+    -> __cxx_atomic_underlying_t<_Tp> {
+  typedef __cxx_atomic_underlying_t<_Tp> _Up;
+  typedef typename __cxx_atomic_lse_type<_Up>::type _Lt;
+  return static_cast<_Up>(__cxx_atomic_lse_fetch_max(
+    (_Lt volatile*)__cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a)),
+    static_cast<_Lt>(__val), __cxx_atomic_order_to_int(__order)));
+}
 
-  while(__desired == __val &&
-          !__cxx_atomic_compare_exchange_strong(__a, &__expected, __desired, __order, __order)) {
-      __desired = __expected < __val ? __expected : __val;
-  }
+template <typename _Tp, typename _Td>
+inline auto __cxx_atomic_fetch_min_n(_Tp* __a, _Td __val, __cxx_atomic_underlying_t<_Tp>, memory_order __order, true_type)
+    -> __cxx_atomic_underlying_t<_Tp> {
+  typedef __cxx_atomic_underlying_t<_Tp> _Up;
+  typedef typename __cxx_atomic_lse_type<_Up>::type _Lt;
+  return static_cast<_Up>(__cxx_atomic_lse_fetch_min(
+    (_Lt volatile*)__cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a)),
+    static_cast<_Lt>(__val), __cxx_atomic_order_to_int(__order)));
+}
+
+#else
 
+template <typename _Tp>
+using __cxx_atomic_has_lse_minmax = false_type;
+
+#endif // __aarch64__ && __ARM_FEATURE_ATOMICS
+
+template <typename _Tp, typename _Td>
+inline auto __cxx_atomic_fetch_max_n(_Tp* __a, _Td __val, __cxx_atomic_underlying_t<_Tp> __expected,
+                                     memory_order __order, false_type) -> __cxx_atomic_underlying_t<_Tp> {
+  while(__expected < __val &&
+          !__cxx_atomic_compare_exchange_weak(__a, &__expected, __cxx_atomic_underlying_t<_Tp>(__val), __order, __cxx_atomic_load_order(__order)))
+    ;
   return __expected;
 }
 
+template <typename _Tp, typename _Td>
+inline auto __cxx_atomic_fetch_min_n(_Tp* __a, _Td __val, __cxx_atomic_underlying_t<_Tp> __expected,
+                                     memory_order __order, false_type) -> __cxx_atomic_underlying_t<_Tp> {
+  while(__val < __expected &&
+          !__cxx_atomic_compare_exchange_weak(__a, &__expected, __cxx_atomic_underlying_t<_Tp>(__val), __order, __cxx_atomic_load_order(__order)))
+    ;
+  return __expected;
+}
+
+// Most calls in a contended reduction find the object already at or past the
+// value, so a plain load settles them without taking the cache line exclusive.
+template <typename _Tp, typename _Td>
+inline auto __cxx_atomic_fetch_max(_Tp* __a, _Td __val,
+                           memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
+  auto const __current = __cxx_atomic_load(__a, __cxx_atomic_load_order(__order));
+  if(!(__current < __val))
+    return __current;
+  return __cxx_atomic_fetch_max_n(__a, __val, __current, __order,
+                                  __cxx_atomic_has_lse_minmax<__cxx_atomic_underlying_t<_Tp>>());
+}
+
+template <typename _Tp, typename _Td>
+inline auto __cxx_atomic_fetch_min(_Tp* __a, _Td __val,
+                           memory_order __order) -> __cxx_atomic_underlying_t<_Tp> {
+  auto const __current = __cxx_atomic_load(__a, __cxx_atomic_load_order(__order));
+  if(!(__val < __current))
+    return __current;
+  return __cxx_atomic_fetch_min_n(__a, __val, __current, __order,
+                                  __cxx_atomic_has_lse_minmax<__cxx_atomic_underlying_t<_Tp>>());
+}
+
 #endif // _LIBCUDACXX_ATOMIC_BASE_H
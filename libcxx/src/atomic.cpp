@@ -13,11 +13,10 @@ _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
 #if !defined(_LIBCUDACXX_HAS_NO_THREAD_CONTENTION_TABLE) && (_LIBCUDACXX_STD_VER >= 11)
 
-__libcpp_contention_t __libcpp_contention_state_[ 256 /* < there's no magic in this number */ ];
-
+// The contention table itself is defined inline in <__threading_support>.
 _LIBCUDACXX_FUNC_VIS
 __libcpp_contention_t * __libcpp_contention_state(void const volatile * p) _NOEXCEPT {
-    return __libcpp_contention_state_ + ((std::uintptr_t)p & 255);
+    return __libcpp_contention_slot(p);
 }
 
 #endif //_LIBCUDACXX_HAS_NO_THREAD_CONTENTION_TABLE